@@ -0,0 +1,85 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/external/googletest/CMakeLists.txt"
+  "/root/repo/external/googletest/googlemock/CMakeLists.txt"
+  "/root/repo/external/googletest/googlemock/cmake/gmock.pc.in"
+  "/root/repo/external/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/root/repo/external/googletest/googletest/CMakeLists.txt"
+  "/root/repo/external/googletest/googletest/cmake/Config.cmake.in"
+  "/root/repo/external/googletest/googletest/cmake/gtest.pc.in"
+  "/root/repo/external/googletest/googletest/cmake/gtest_main.pc.in"
+  "/root/repo/external/googletest/googletest/cmake/internal_utils.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/googletest/googletest/generated/gmock.pc"
+  "external/googletest/googletest/generated/gmock_main.pc"
+  "external/googletest/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/googletest/googletest/generated/GTestConfigVersion.cmake"
+  "external/googletest/googletest/generated/GTestConfig.cmake"
+  "external/googletest/googletest/generated/gtest.pc"
+  "external/googletest/googletest/generated/gtest_main.pc"
+  "external/googletest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/test_EmbeddedProto.dir/DependInfo.cmake"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/DependInfo.cmake"
+  "external/googletest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "external/googletest/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "external/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "external/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmark/benchmark_batch.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_batch.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_batch.o.d"
+  "/root/repo/benchmark/benchmark_buffer_type.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_buffer_type.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_buffer_type.o.d"
+  "/root/repo/benchmark/benchmark_copy.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_copy.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_copy.o.d"
+  "/root/repo/benchmark/benchmark_frame_index.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_frame_index.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_frame_index.o.d"
+  "/root/repo/benchmark/benchmark_move.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_move.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_move.o.d"
+  "/root/repo/benchmark/main.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/main.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/main.o.d"
+  "/root/repo/src/Fields.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/src/Fields.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/src/Fields.o.d"
+  "/root/repo/src/MessageInterface.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/src/MessageInterface.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/src/MessageInterface.o.d"
+  "/root/repo/src/ReadBufferSection.cpp" "CMakeFiles/benchmark_EmbeddedProto.dir/src/ReadBufferSection.o" "gcc" "CMakeFiles/benchmark_EmbeddedProto.dir/src/ReadBufferSection.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_batch.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_batch.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_buffer_type.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_buffer_type.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_copy.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_copy.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_frame_index.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_frame_index.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_move.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/benchmark_move.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/main.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/benchmark/main.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/Fields.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/Fields.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/MessageInterface.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/MessageInterface.o.d"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/ReadBufferSection.o"
+  "CMakeFiles/benchmark_EmbeddedProto.dir/src/ReadBufferSection.o.d"
+  "benchmark_EmbeddedProto"
+  "benchmark_EmbeddedProto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_EmbeddedProto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/src/Fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/src/Fields.o.d"
+  "/root/repo/src/MessageInterface.cpp" "CMakeFiles/test_EmbeddedProto.dir/src/MessageInterface.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/src/MessageInterface.o.d"
+  "/root/repo/src/ReadBufferSection.cpp" "CMakeFiles/test_EmbeddedProto.dir/src/ReadBufferSection.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/src/ReadBufferSection.o.d"
+  "/root/repo/test/test_EmbeddedProto.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_EmbeddedProto.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_EmbeddedProto.o.d"
+  "/root/repo/test/test_IncludeOtherFiles.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_IncludeOtherFiles.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_IncludeOtherFiles.o.d"
+  "/root/repo/test/test_MessageSizeCalculator.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_MessageSizeCalculator.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_MessageSizeCalculator.o.d"
+  "/root/repo/test/test_NestedMessage.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_NestedMessage.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_NestedMessage.o.d"
+  "/root/repo/test/test_ReadBufferFixedSize.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferFixedSize.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferFixedSize.o.d"
+  "/root/repo/test/test_ReadBufferSection.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferSection.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferSection.o.d"
+  "/root/repo/test/test_RepeatedFieldFixedSize.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldFixedSize.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldFixedSize.o.d"
+  "/root/repo/test/test_RepeatedFieldMessage.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldMessage.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldMessage.o.d"
+  "/root/repo/test/test_SimpleTypes.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_SimpleTypes.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_SimpleTypes.o.d"
+  "/root/repo/test/test_WriteBufferFixedSize.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_WriteBufferFixedSize.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_WriteBufferFixedSize.o.d"
+  "/root/repo/test/test_cached_serializer.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_cached_serializer.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_cached_serializer.o.d"
+  "/root/repo/test/test_compact_layout.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_compact_layout.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_compact_layout.o.d"
+  "/root/repo/test/test_empty_messages.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_empty_messages.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_empty_messages.o.d"
+  "/root/repo/test/test_field_mask.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_field_mask.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_field_mask.o.d"
+  "/root/repo/test/test_field_options.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_field_options.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_field_options.o.d"
+  "/root/repo/test/test_frame_index.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_frame_index.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_frame_index.o.d"
+  "/root/repo/test/test_lazy_fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_lazy_fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_lazy_fields.o.d"
+  "/root/repo/test/test_max_serialized_size.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_max_serialized_size.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_max_serialized_size.o.d"
+  "/root/repo/test/test_message_batch.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_batch.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_batch.o.d"
+  "/root/repo/test/test_message_equality.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_equality.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_equality.o.d"
+  "/root/repo/test/test_message_index.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_index.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_message_index.o.d"
+  "/root/repo/test/test_oneof_fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_oneof_fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_oneof_fields.o.d"
+  "/root/repo/test/test_optional_fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_optional_fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_optional_fields.o.d"
+  "/root/repo/test/test_stream_fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_stream_fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_stream_fields.o.d"
+  "/root/repo/test/test_string_bytes.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_string_bytes.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_string_bytes.o.d"
+  "/root/repo/test/test_track_changes.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_track_changes.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_track_changes.o.d"
+  "/root/repo/test/test_trivially_copyable.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_trivially_copyable.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_trivially_copyable.o.d"
+  "/root/repo/test/test_unkown_fields.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_unkown_fields.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_unkown_fields.o.d"
+  "/root/repo/test/test_validate.cpp" "CMakeFiles/test_EmbeddedProto.dir/test/test_validate.o" "gcc" "CMakeFiles/test_EmbeddedProto.dir/test/test_validate.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/external/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/external/googletest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
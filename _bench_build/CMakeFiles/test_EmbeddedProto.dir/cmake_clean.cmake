@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EmbeddedProto.dir/src/Fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/src/Fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/src/MessageInterface.o"
+  "CMakeFiles/test_EmbeddedProto.dir/src/MessageInterface.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/src/ReadBufferSection.o"
+  "CMakeFiles/test_EmbeddedProto.dir/src/ReadBufferSection.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_EmbeddedProto.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_EmbeddedProto.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_IncludeOtherFiles.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_IncludeOtherFiles.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_MessageSizeCalculator.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_MessageSizeCalculator.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_NestedMessage.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_NestedMessage.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferFixedSize.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferFixedSize.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferSection.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_ReadBufferSection.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldFixedSize.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldFixedSize.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldMessage.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_RepeatedFieldMessage.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_SimpleTypes.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_SimpleTypes.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_WriteBufferFixedSize.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_WriteBufferFixedSize.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_cached_serializer.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_cached_serializer.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_compact_layout.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_compact_layout.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_empty_messages.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_empty_messages.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_field_mask.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_field_mask.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_field_options.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_field_options.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_frame_index.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_frame_index.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_lazy_fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_lazy_fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_max_serialized_size.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_max_serialized_size.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_batch.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_batch.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_equality.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_equality.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_index.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_message_index.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_oneof_fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_oneof_fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_optional_fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_optional_fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_stream_fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_stream_fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_string_bytes.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_string_bytes.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_track_changes.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_track_changes.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_trivially_copyable.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_trivially_copyable.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_unkown_fields.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_unkown_fields.o.d"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_validate.o"
+  "CMakeFiles/test_EmbeddedProto.dir/test/test_validate.o.d"
+  "test_EmbeddedProto"
+  "test_EmbeddedProto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EmbeddedProto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
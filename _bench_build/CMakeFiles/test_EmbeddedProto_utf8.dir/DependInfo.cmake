@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Fields.cpp" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/Fields.o" "gcc" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/Fields.o.d"
+  "/root/repo/src/MessageInterface.cpp" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/MessageInterface.o" "gcc" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/MessageInterface.o.d"
+  "/root/repo/src/ReadBufferSection.cpp" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/ReadBufferSection.o" "gcc" "CMakeFiles/test_EmbeddedProto_utf8.dir/src/ReadBufferSection.o.d"
+  "/root/repo/test/test_EmbeddedProto.cpp" "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_EmbeddedProto.o" "gcc" "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_EmbeddedProto.o.d"
+  "/root/repo/test/test_string_bytes.cpp" "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_string_bytes.o" "gcc" "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_string_bytes.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/external/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/external/googletest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
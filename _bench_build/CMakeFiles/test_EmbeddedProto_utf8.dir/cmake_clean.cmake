@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/Fields.o"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/Fields.o.d"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/MessageInterface.o"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/MessageInterface.o.d"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/ReadBufferSection.o"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/src/ReadBufferSection.o.d"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_EmbeddedProto.o"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_EmbeddedProto.o.d"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_string_bytes.o"
+  "CMakeFiles/test_EmbeddedProto_utf8.dir/test/test_string_bytes.o.d"
+  "test_EmbeddedProto_utf8"
+  "test_EmbeddedProto_utf8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EmbeddedProto_utf8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
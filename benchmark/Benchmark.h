@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace benchmark
+{
+
+  //! Call func repeatedly for about a second and print the number of items processed per second.
+  /*!
+    \param name The name printed in front of the result.
+    \param items_per_call The number of items, for example messages, processed in a single call.
+    \param func The function to measure. It should return something depending on the work done 
+           so the compiler can not remove it.
+    \return The number of items per second.
+  */
+  template<class FUNC>
+  double run(const char* name, const uint32_t items_per_call, FUNC func)
+  {
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::chrono::milliseconds DURATION{1000};
+
+    volatile uint32_t sink = 0;
+    uint64_t n_calls = 0;
+    const auto start = Clock::now();
+    auto elapsed = Clock::now() - start;
+    while(DURATION > elapsed)
+    {
+      // Check the clock once every batch of calls to limit its influence.
+      for(uint32_t i = 0; i < 64; ++i)
+      {
+        sink = sink + static_cast<uint32_t>(func());
+      }
+      n_calls += 64;
+      elapsed = Clock::now() - start;
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const double items_per_second = static_cast<double>(n_calls * items_per_call) / seconds;
+    printf("%-48s %12.0f items/s\n", name, items_per_second);
+    return items_per_second;
+  }
+
+  //! Copying generated messages.
+  void copy();
+
+  //! Copying versus moving messages with nested messages and strings.
+  void move();
+
+  //! Serializing and deserializing through the buffer interfaces and through the concrete buffers.
+  void buffer_type();
+
+  //! Serializing and deserializing messages one by one and with serialize_batch().
+  void batch();
+
+  //! Building a FrameIndex and decoding ranges of frames on multiple threads.
+  void frame_index();
+
+} // End of namespace benchmark
+
+#endif // End of _BENCHMARK_H_
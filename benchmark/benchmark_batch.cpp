@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "Benchmark.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <MessageBatch.h>
+
+#include <array>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace benchmark
+{
+
+namespace
+{
+  constexpr uint32_t N_MESSAGES = 100;
+  using MsgB = ::demo::space::message_b<3>;
+}
+
+void batch()
+{
+  printf("Batches of %u messages\n", N_MESSAGES);
+
+  static std::array<MsgB, N_MESSAGES> messages;
+  for(uint32_t i = 0; i < N_MESSAGES; ++i)
+  {
+    messages[i].set_u(0.5 * i);
+    messages[i].set_v(static_cast<int32_t>(i));
+    messages[i].mutable_nested_a().add_x(static_cast<int32_t>(i));
+    messages[i].mutable_nested_a().set_y(1.5F);
+  }
+
+  static ::EmbeddedProto::WriteBufferFixedSize<N_MESSAGES * MsgB::MAX_SERIALIZED_SIZE> buffer;
+  run("serialize one by one through the interface", N_MESSAGES, [&]() {
+    buffer.clear();
+    ::EmbeddedProto::WriteBufferInterface& interface = buffer;
+    for(const auto& msg : messages)
+    {
+      const ::EmbeddedProto::MessageInterface& base = msg;
+      static_cast<void>(::EmbeddedProto::WireFormatter::SerializeVarint(base.serialized_size(), interface));
+      static_cast<void>(base.serialize(interface));
+    }
+    return buffer.get_size();
+  });
+
+  run("serialize_batch", N_MESSAGES, [&]() {
+    buffer.clear();
+    uint32_t n_serialized = 0;
+    static_cast<void>(::EmbeddedProto::serialize_batch(messages.data(), N_MESSAGES, buffer, n_serialized));
+    return buffer.get_size();
+  });
+
+  static std::array<MsgB, N_MESSAGES> result;
+  run("deserialize_batch", N_MESSAGES, [&]() {
+    ::EmbeddedProto::ReadBufferView view(buffer.get_data(), buffer.get_size());
+    uint32_t n = 0;
+    static_cast<void>(::EmbeddedProto::deserialize_batch(view, result.data(), N_MESSAGES, n));
+    return n;
+  });
+}
+
+} // End of namespace benchmark
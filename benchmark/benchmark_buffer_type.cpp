@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "Benchmark.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <MessageInterface.h>
+
+#include <cstring>
+
+// EAMS message definitions
+#include <simple_types.h>
+#include <nested_message.h>
+
+namespace benchmark
+{
+
+namespace
+{
+  constexpr uint32_t N_MESSAGES = 64;
+
+  //! Serialize and deserialize the same message through the interfaces and through the concrete buffers.
+  template<class MESSAGE_TYPE>
+  void compare(const char* name, const MESSAGE_TYPE& msg)
+  {
+    static ::EmbeddedProto::WriteBufferFixedSize<MESSAGE_TYPE::MAX_SERIALIZED_SIZE> write_buffer;
+    static ::EmbeddedProto::ReadBufferFixedSize<MESSAGE_TYPE::MAX_SERIALIZED_SIZE> read_buffer;
+    static MESSAGE_TYPE result;
+    char label[64];
+
+    // The virtual functions of MessageInterface, with the buffer interfaces.
+    snprintf(label, sizeof(label), "%s serialize, interface", name);
+    run(label, N_MESSAGES, [&]() {
+      const ::EmbeddedProto::MessageInterface& base = msg;
+      ::EmbeddedProto::WriteBufferInterface& interface = write_buffer;
+      for(uint32_t i = 0; i < N_MESSAGES; ++i)
+      {
+        write_buffer.clear();
+        static_cast<void>(base.serialize(interface));
+      }
+      return write_buffer.get_size();
+    });
+
+    // The template functions instantiated for the concrete buffer.
+    snprintf(label, sizeof(label), "%s serialize, template", name);
+    run(label, N_MESSAGES, [&]() {
+      for(uint32_t i = 0; i < N_MESSAGES; ++i)
+      {
+        write_buffer.clear();
+        static_cast<void>(msg.serialize(write_buffer));
+      }
+      return write_buffer.get_size();
+    });
+
+    // Both deserialize variants refill the read buffer the same way before each message.
+    const uint32_t size = write_buffer.get_size();
+    snprintf(label, sizeof(label), "%s deserialize, interface", name);
+    run(label, N_MESSAGES, [&]() {
+      ::EmbeddedProto::MessageInterface& base = result;
+      ::EmbeddedProto::ReadBufferInterface& interface = read_buffer;
+      for(uint32_t i = 0; i < N_MESSAGES; ++i)
+      {
+        read_buffer.clear();
+        memcpy(read_buffer.get_data(), write_buffer.get_data(), size);
+        read_buffer.set_bytes_written(size);
+        base.clear();
+        static_cast<void>(base.deserialize(interface));
+      }
+      return static_cast<uint32_t>(result.serialized_size());
+    });
+
+    snprintf(label, sizeof(label), "%s deserialize, template", name);
+    run(label, N_MESSAGES, [&]() {
+      for(uint32_t i = 0; i < N_MESSAGES; ++i)
+      {
+        read_buffer.clear();
+        memcpy(read_buffer.get_data(), write_buffer.get_data(), size);
+        read_buffer.set_bytes_written(size);
+        result.clear();
+        static_cast<void>(result.deserialize(read_buffer));
+      }
+      return static_cast<uint32_t>(result.serialized_size());
+    });
+  }
+}
+
+void buffer_type()
+{
+  printf("Serialize and deserialize through the buffer interfaces versus the concrete buffer types\n");
+
+  // Only scalar fields, these benefit most from inlined buffer calls.
+  static Test_Simple_Types scalars;
+  scalars.set_a_int32(-12345);
+  scalars.set_a_int64(-1234567890123);
+  scalars.set_a_uint32(12345);
+  scalars.set_a_uint64(1234567890123);
+  scalars.set_a_sint32(-12345);
+  scalars.set_a_sint64(-1234567890123);
+  scalars.set_a_bool(true);
+  scalars.set_a_enum(Test_Enum::ONEHUNDERTTWENTYSEVEN);
+  scalars.set_a_fixed64(1234567890123);
+  scalars.set_a_sfixed64(-1234567890123);
+  scalars.set_a_double(1.5);
+  scalars.set_a_fixed32(12345);
+  scalars.set_a_sfixed32(-12345);
+  scalars.set_a_float(2.5F);
+  compare("Test_Simple_Types", scalars);
+
+  // A nested message and a repeated field, these still use the virtual Field interface.
+  static ::demo::space::message_b<3> nested;
+  nested.set_u(1.5);
+  nested.set_v(-5);
+  nested.mutable_nested_a().add_x(1);
+  nested.mutable_nested_a().add_x(2);
+  nested.mutable_nested_a().set_y(2.5F);
+  nested.mutable_nested_a().set_z(-3);
+  compare("message_b", nested);
+}
+
+} // End of namespace benchmark
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "Benchmark.h"
+
+#include <array>
+
+// EAMS message definitions
+#include <simple_types.h>
+#include <string_bytes.h>
+
+namespace benchmark
+{
+
+namespace
+{
+  constexpr uint32_t N_MESSAGES = 256;
+}
+
+void copy()
+{
+  printf("Copy of arrays of %u messages\n", N_MESSAGES);
+  printf("  sizeof(Test_Simple_Types) = %u bytes, sizeof(text<16>) = %u bytes\n", 
+         static_cast<uint32_t>(sizeof(Test_Simple_Types)), static_cast<uint32_t>(sizeof(text<16>)));
+
+  // Only scalar fields, the copy constructor and assignment are defaulted.
+  static std::array<Test_Simple_Types, N_MESSAGES> scalars_src;
+  static std::array<Test_Simple_Types, N_MESSAGES> scalars_dst;
+  for(uint32_t i = 0; i < N_MESSAGES; ++i)
+  {
+    scalars_src[i].set_a_int32(static_cast<int32_t>(i));
+    scalars_src[i].set_a_double(1.5 * i);
+    scalars_src[i].set_a_fixed64(i);
+  }
+  run("scalar fields, defaulted assignment", N_MESSAGES, [&]() {
+    scalars_dst = scalars_src;
+    return scalars_dst[N_MESSAGES - 1].get_a_int32();
+  });
+
+  // A string field, assigned field by field through the setters.
+  static std::array<text<16>, N_MESSAGES> text_src;
+  static std::array<text<16>, N_MESSAGES> text_dst;
+  for(auto& t : text_src)
+  {
+    t.mutable_txt() = "some text";
+  }
+  run("string field, assignment through setters", N_MESSAGES, [&]() {
+    text_dst = text_src;
+    return text_dst[N_MESSAGES - 1].get_txt().get_length();
+  });
+}
+
+} // End of namespace benchmark
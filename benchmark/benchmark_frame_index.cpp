@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "Benchmark.h"
+
+#include <WriteBufferFixedSize.h>
+#include <MessageBatch.h>
+#include <FrameIndex.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace benchmark
+{
+
+namespace
+{
+  constexpr uint32_t N_FRAMES = 10000;
+  using MsgB = ::demo::space::message_b<3>;
+}
+
+void frame_index()
+{
+  printf("Decoding a stream of %u frames, %u hardware threads\n", N_FRAMES, 
+         std::thread::hardware_concurrency());
+
+  static std::array<MsgB, N_FRAMES> messages;
+  for(uint32_t i = 0; i < N_FRAMES; ++i)
+  {
+    messages[i].set_u(0.5 * i);
+    messages[i].set_v(static_cast<int32_t>(i));
+    messages[i].mutable_nested_a().add_x(static_cast<int32_t>(i));
+    messages[i].mutable_nested_a().set_y(1.5F);
+  }
+  static ::EmbeddedProto::WriteBufferFixedSize<N_FRAMES * MsgB::MAX_SERIALIZED_SIZE> stream;
+  uint32_t n_serialized = 0;
+  static_cast<void>(::EmbeddedProto::serialize_batch(messages.data(), N_FRAMES, stream, n_serialized));
+
+  static ::EmbeddedProto::FrameIndex<N_FRAMES> index;
+  run("build the index", N_FRAMES, [&]() {
+    static_cast<void>(index.build(stream.get_data(), stream.get_size()));
+    return index.get_n_frames();
+  });
+
+  // Split the frames in equal ranges, each decoded by its own thread.
+  for(uint32_t n_threads = 1; n_threads <= 8; n_threads *= 2)
+  {
+    char name[48];
+    snprintf(name, sizeof(name), "decode ranges on %u threads", n_threads);
+    run(name, N_FRAMES, [&]() {
+      std::vector<std::thread> workers;
+      std::vector<uint32_t> n_decoded(n_threads, 0);
+      const uint32_t range = N_FRAMES / n_threads;
+      for(uint32_t t = 0; t < n_threads; ++t)
+      {
+        workers.emplace_back([&, t]() {
+          MsgB msg;
+          static_cast<void>(index.decode(t * range, range, msg, [&](const uint32_t, const MsgB&) {
+            ++n_decoded[t];
+          }));
+        });
+      }
+      uint32_t total = 0;
+      for(uint32_t t = 0; t < n_threads; ++t)
+      {
+        workers[t].join();
+        total += n_decoded[t];
+      }
+      return total;
+    });
+  }
+}
+
+} // End of namespace benchmark
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "Benchmark.h"
+
+#include <array>
+#include <utility>
+
+// EAMS message definitions
+#include <string_bytes.h>
+
+namespace benchmark
+{
+
+namespace
+{
+  constexpr uint32_t N_MESSAGES = 64;
+
+  // Two repeated strings, two repeated bytes and two nested messages holding a string or bytes.
+  using Message = repeated_string_bytes<4, 32, 4, 32, 32, 32>;
+}
+
+void move()
+{
+  printf("Copy versus move of arrays of %u messages with nested messages and strings\n", N_MESSAGES);
+  printf("  sizeof(repeated_string_bytes<4, 32, 4, 32, 32, 32>) = %u bytes\n", 
+         static_cast<uint32_t>(sizeof(Message)));
+
+  static std::array<Message, N_MESSAGES> src;
+  static std::array<Message, N_MESSAGES> dst;
+  ::EmbeddedProto::FieldString<32> str;
+  str = "an element of the array";
+  const uint8_t raw[] = {1, 2, 3, 4};
+  for(auto& msg : src)
+  {
+    msg.add_array_of_txt(str);
+    msg.add_array_of_txt(str);
+    msg.mutable_nested_text().mutable_txt() = "nested text";
+    static_cast<void>(msg.mutable_nested_bytes().mutable_b().set(raw, sizeof(raw)));
+  }
+
+  run("copy assignment", N_MESSAGES, [&]() {
+    for(uint32_t i = 0; i < N_MESSAGES; ++i)
+    {
+      dst[i] = src[i];
+    }
+    return dst[N_MESSAGES - 1].get_nested_text().get_txt().get_length();
+  });
+
+  // The storage of the fields is fixed, moving leaves the source as it was. It can therefore be 
+  // moved from again in the next call.
+  run("move assignment", N_MESSAGES, [&]() {
+    for(uint32_t i = 0; i < N_MESSAGES; ++i)
+    {
+      dst[i] = std::move(src[i]);
+    }
+    return dst[N_MESSAGES - 1].get_nested_text().get_txt().get_length();
+  });
+
+  run("copy construction", N_MESSAGES, [&]() {
+    uint32_t length = 0;
+    for(uint32_t i = 0; i < N_MESSAGES; ++i)
+    {
+      const Message copy(src[i]);
+      length += copy.get_nested_text().get_txt().get_length();
+    }
+    return length;
+  });
+
+  run("move construction", N_MESSAGES, [&]() {
+    uint32_t length = 0;
+    for(uint32_t i = 0; i < N_MESSAGES; ++i)
+    {
+      const Message moved(std::move(src[i]));
+      length += moved.get_nested_text().get_txt().get_length();
+    }
+    return length;
+  });
+}
+
+} // End of namespace benchmark
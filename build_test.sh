@@ -45,6 +45,10 @@ protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto --eams_out=./buil
 protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto --eams_out=./build/EAMS ./test/proto/empty_message.proto
 protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto --eams_out=./build/EAMS ./test/proto/optional_fields.proto
 protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto -I./generator --eams_out=./build/EAMS ./test/proto/field_options.proto
+protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto -I./generator --eams_out=./build/EAMS ./test/proto/compact_layout.proto
+protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto -I./generator --eams_out=./build/EAMS ./test/proto/lazy_fields.proto
+protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto -I./generator --eams_out=./build/EAMS ./test/proto/track_changes.proto
+protoc --plugin=protoc-gen-eams=protoc-gen-eams -I./test/proto -I./generator --eams_out=./build/EAMS ./test/proto/stream_fields.proto
 
 # For validation and testing generate the same message using python
 mkdir -p ./build/python
@@ -60,6 +64,10 @@ protoc -I./test/proto --python_out=./build/python ./test/proto/empty_file_to_inc
 protoc -I./test/proto --python_out=./build/python ./test/proto/string_bytes.proto
 protoc -I./test/proto --python_out=./build/python ./test/proto/optional_fields.proto
 protoc -I./test/proto -I./generator --python_out=./build/python ./test/proto/field_options.proto
+protoc -I./test/proto -I./generator --python_out=./build/python ./test/proto/compact_layout.proto
+protoc -I./test/proto -I./generator --python_out=./build/python ./test/proto/lazy_fields.proto
+protoc -I./test/proto -I./generator --python_out=./build/python ./test/proto/track_changes.proto
+protoc -I./test/proto -I./generator --python_out=./build/python ./test/proto/stream_fields.proto
 
 # Build the tests
 cmake -DCMAKE_BUILD_TYPE=Debug -B./build/test
@@ -31,6 +31,7 @@
 set -euxo pipefail
 
 ./build/test/test_EmbeddedProto --gtest_output="xml:build/test/test_details.xml"
+./build/test/test_EmbeddedProto_utf8 --gtest_output="xml:build/test/test_details_utf8.xml"
 
 rm -rf ./code_coverage_report/*
 mkdir -p code_coverage_report
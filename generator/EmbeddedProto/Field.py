@@ -32,6 +32,36 @@ from google.protobuf.descriptor_pb2 import FieldDescriptorProto
 from . import embedded_proto_options_pb2
 import copy
 
+# The alignment used to sort member variables which contain a pointer, for example the virtual table of a class. The
+# value sorts between 4 and 8 bytes which makes the resulting order valid on both 32 and 64 bit targets.
+POINTER_ALIGNMENT = 6
+
+
+# Calculate the number of bytes required to serialize the given value as a varint.
+def varint_size(value):
+    size = 1
+    while 0x80 <= value:
+        value >>= 7
+        size += 1
+    return size
+
+
+# Calculate the number of bytes required to serialize the tag of the given field number.
+def tag_size(field_number):
+    return varint_size(field_number << 3)
+
+
+# Calculate the size and alignment of a class with the given member variables. Each member is given as a tuple with
+# its size and alignment in bytes.
+def struct_layout(members):
+    size = 0
+    alignment = 1
+    for member_size, member_alignment in members:
+        size = -(-size // member_alignment) * member_alignment + member_size
+        alignment = max(alignment, member_alignment)
+    size = -(-size // alignment) * alignment
+    return size, alignment
+
 
 # This class is the base class for any kind of field used in protobuf messages.
 class Field:
@@ -56,6 +86,12 @@ class Field:
 
         self.of_type_enum = FieldDescriptorProto.TYPE_ENUM == proto_descriptor.type
 
+        # Is the value of this field stored as a bit in the presence array of the parent message.
+        self.bit_packed = False
+
+        # Serialize the field even when it holds the default value, set while rendering serialize_changed().
+        self.force_serialize = False
+
     @staticmethod
     # This function create the appropriate field object for a variable defined in the message.
     # The descriptor and parent message parameters are required parameters, all field need them to be created. The oneof
@@ -74,13 +110,18 @@ class Field:
         elif (FieldDescriptorProto.LABEL_REPEATED == proto_descriptor.label) and not already_nested:
             result = FieldRepeated(proto_descriptor, parent_msg, oneof)
         elif FieldDescriptorProto.TYPE_MESSAGE == proto_descriptor.type:
-            result = FieldMessage(proto_descriptor, parent_msg, oneof)
+            result = FieldMessage(proto_descriptor, parent_msg, oneof, already_nested)
         elif FieldDescriptorProto.TYPE_ENUM == proto_descriptor.type:
             result = FieldEnum(proto_descriptor, parent_msg, oneof)
+        elif FieldBytesStream.is_streamed(proto_descriptor) and (oneof is None) and not already_nested:
+            result = FieldBytesStream(proto_descriptor, parent_msg)
         elif FieldDescriptorProto.TYPE_STRING == proto_descriptor.type:
             result = FieldString(proto_descriptor, parent_msg, oneof)
         elif FieldDescriptorProto.TYPE_BYTES == proto_descriptor.type:
             result = FieldBytes(proto_descriptor, parent_msg, oneof)
+        elif (FieldDescriptorProto.TYPE_BOOL == proto_descriptor.type) and parent_msg.compact_layout \
+                and (oneof is None) and not already_nested:
+            result = FieldBoolBit(proto_descriptor, parent_msg)
         else:
             result = FieldBasic(proto_descriptor, parent_msg, oneof)
         return result
@@ -110,6 +151,95 @@ class Field:
     def get_variable_id_name(self):
         return self.variable_id_name
 
+    # The C++ expression calculating the maximum number of bytes this field takes when serialized, including the tag.
+    def get_max_serialized_size_expression(self):
+        return self.get_type() + "::max_serialized_size_with_id(static_cast<uint32_t>(FieldNumber::" + \
+               self.get_variable_id_name() + "))"
+
+    # The maximum number of bytes of the value of this field when serialized, excluding the tag and length. None is
+    # returned when this depends on template parameters.
+    def get_max_value_size(self):
+        return None
+
+    # The maximum number of bytes this field takes when serialized, including the tag.
+    def get_max_serialized_size(self):
+        result = None
+        value_size = self.get_max_value_size()
+        if value_size is not None:
+            result = tag_size(self.variable_id) + value_size
+            if "LENGTH_DELIMITED" == self.get_wire_type_str():
+                result += varint_size(value_size)
+        return result
+
+    # The estimated size and alignment in bytes of the member variable for the given pointer size. None is returned
+    # when this depends on template parameters.
+    def get_ram_size(self, pointer_size):
+        return None
+
+    # Is the C++ type of this field trivially copyable.
+    def is_trivially_copyable(self):
+        return False
+
+    # Does the default copy of the C++ type of this field give the same result as using the setter. This holds for
+    # trivially copyable types and for classes holding only those.
+    def is_memberwise_copyable(self):
+        return self.is_trivially_copyable()
+
+    # The C++ type of the member variable, usually the same as the type of the field.
+    def get_member_type(self):
+        return self.get_type()
+
+    # Does this field have a setter taking an rvalue which is cheaper than a copy. Scalars are just copied.
+    def is_movable(self):
+        return False
+
+    # The argument passed to the setter in the generated copy and move functions of the parent message.
+    def get_copy_source(self, move):
+        if move and self.is_movable():
+            return "std::move(rhs.mutable_" + self.get_name() + "())"
+        return "rhs.get_" + self.get_name() + "()"
+
+    # Does the FieldMask of the parent message hold a nested mask for this field.
+    def has_field_mask(self):
+        return False
+
+    # Render the serialization of this field when a FieldMask is used. Only message fields differ as they can take a
+    # nested mask.
+    def render_serialize_masked(self, jinja_env):
+        return self.render_serialize(jinja_env)
+
+    # Render the deserialization of this field when a FieldMask is used.
+    def render_deserialize_masked(self, jinja_env):
+        return self.render_deserialize(jinja_env)
+
+    # Can this field occur more than once in a serialized message.
+    def is_repeated(self):
+        return False
+
+    # Do the setters of this field mark it as changed in the parent message.
+    def tracks_changes(self):
+        return self.parent.track_changes
+
+    # The statement marking this field as changed, used in single line setters.
+    def get_mark_changed(self):
+        result = ""
+        if self.tracks_changes():
+            result = "changed_.set(FieldNumber::" + self.get_variable_id_name() + "); "
+        return result
+
+    # Render the serialization of this field for serialize_changed(). A changed field is also serialized when it holds
+    # the default value, otherwise a receiver merging the data would keep the old value.
+    def render_serialize_changed(self, jinja_env):
+        self.force_serialize = True
+        result = self.render_serialize(jinja_env)
+        self.force_serialize = False
+        return result
+
+    # The estimated alignment in bytes of the member variable, used to order the members in a compact layout. By
+    # default fields are objects with a virtual table.
+    def get_alignment(self):
+        return POINTER_ALIGNMENT
+
     # Returns a list with a dictionaries for each template parameter this field had. The dictionary holds the parameter
     # name and its type.
     def get_template_parameters(self):
@@ -215,6 +345,37 @@ class FieldBasic(Field):
                          FieldDescriptorProto.TYPE_FLOAT:    "FIXED32",
                          FieldDescriptorProto.TYPE_SFIXED32: "FIXED32"}
 
+    # A dictionary to convert the wire type into the alignment of the C++ type.
+    type_to_alignment = {FieldDescriptorProto.TYPE_DOUBLE:   8,
+                         FieldDescriptorProto.TYPE_FLOAT:    4,
+                         FieldDescriptorProto.TYPE_INT64:    8,
+                         FieldDescriptorProto.TYPE_UINT64:   8,
+                         FieldDescriptorProto.TYPE_INT32:    4,
+                         FieldDescriptorProto.TYPE_FIXED64:  8,
+                         FieldDescriptorProto.TYPE_FIXED32:  4,
+                         FieldDescriptorProto.TYPE_BOOL:     1,
+                         FieldDescriptorProto.TYPE_UINT32:   4,
+                         FieldDescriptorProto.TYPE_SFIXED32: 4,
+                         FieldDescriptorProto.TYPE_SFIXED64: 8,
+                         FieldDescriptorProto.TYPE_SINT32:   4,
+                         FieldDescriptorProto.TYPE_SINT64:   8}
+
+    # A dictionary to convert the wire type into the maximum number of bytes of the serialized value. Signed 32 bit
+    # integers are serialized as unsigned 32 bit varints.
+    type_to_max_value_size = {FieldDescriptorProto.TYPE_DOUBLE:   8,
+                              FieldDescriptorProto.TYPE_FLOAT:    4,
+                              FieldDescriptorProto.TYPE_INT64:    10,
+                              FieldDescriptorProto.TYPE_UINT64:   10,
+                              FieldDescriptorProto.TYPE_INT32:    5,
+                              FieldDescriptorProto.TYPE_FIXED64:  8,
+                              FieldDescriptorProto.TYPE_FIXED32:  4,
+                              FieldDescriptorProto.TYPE_BOOL:     1,
+                              FieldDescriptorProto.TYPE_UINT32:   5,
+                              FieldDescriptorProto.TYPE_SFIXED32: 4,
+                              FieldDescriptorProto.TYPE_SFIXED64: 8,
+                              FieldDescriptorProto.TYPE_SINT32:   5,
+                              FieldDescriptorProto.TYPE_SINT64:   10}
+
     def __init__(self, proto_descriptor, parent_msg, oneof=None):
         super().__init__(proto_descriptor, parent_msg, "FieldBasic.h", oneof)
 
@@ -233,6 +394,22 @@ class FieldBasic(Field):
     def get_default_value(self):
         return self.type_to_default_value[self.descriptor.type]
 
+    def get_alignment(self):
+        return self.type_to_alignment[self.descriptor.type]
+
+    def get_max_value_size(self):
+        return self.type_to_max_value_size[self.descriptor.type]
+
+    def is_trivially_copyable(self):
+        return True
+
+    def get_ram_size(self, pointer_size):
+        return self.get_alignment(), self.get_alignment()
+
+    # Fixed width values can be overwritten in serialized data.
+    def is_fixed_width(self):
+        return self.get_wire_type_str() in ("FIXED32", "FIXED64")
+
     def render_get_set(self, jinja_env):
         return self.render("FieldBasic_GetSet.h", jinja_environment=jinja_env)
 
@@ -246,6 +423,35 @@ class FieldBasic(Field):
 # -----------------------------------------------------------------------------
 
 
+# A boolean field in a message with a compact layout. The value is not stored in a member variable of its own but as a
+# bit in the presence array of the message.
+class FieldBoolBit(FieldBasic):
+    def __init__(self, proto_descriptor, parent_msg):
+        super().__init__(proto_descriptor, parent_msg)
+        self.bit_packed = True
+
+    def get_ram_size(self, pointer_size):
+        # The value is stored in the presence array.
+        return 0, 1
+
+    # The name of the bit in the presence array holding the value of this field. The lower case prefix avoids collisions
+    # with the upper case names of the presence flags.
+    def get_value_bit_name(self):
+        return "value_" + self.variable_id_name
+
+    def render_get_set(self, jinja_env):
+        return self.render("FieldBoolBit_GetSet.h", jinja_environment=jinja_env)
+
+    def render_serialize(self, jinja_env):
+        return self.render("FieldBoolBit_Serialize.h", jinja_environment=jinja_env)
+
+    def render_deserialize(self, jinja_env):
+        str = self.render("FieldBoolBit_Deserialize.h", jinja_environment=jinja_env)
+        return str.rstrip()
+
+# -----------------------------------------------------------------------------
+
+
 # A base class for both the String and Bytes type field
 class BaseStringBytes(Field):
     def __init__(self, proto_descriptor, parent_msg, oneof=None):
@@ -262,6 +468,16 @@ class BaseStringBytes(Field):
     def get_wire_type_str(self):
         return "LENGTH_DELIMITED"
 
+    def get_max_value_size(self):
+        return self.MaxLength
+
+    def get_ram_size(self, pointer_size):
+        result = None
+        if self.MaxLength:
+            # The virtual table, the current length and the data array.
+            result = struct_layout([(pointer_size, pointer_size), (4, 4), (self.MaxLength, 1)])
+        return result
+
     def get_template_parameters(self):
         result = []
         # When we do not have a maximum length specified add the length as a template param.
@@ -329,6 +545,47 @@ class FieldBytes(BaseStringBytes):
 # -----------------------------------------------------------------------------
 
 
+# This class defines a string or bytes field of which the data is not stored in the message but streamed.
+class FieldBytesStream(BaseStringBytes):
+    def __init__(self, proto_descriptor, parent_msg):
+        super().__init__(proto_descriptor, parent_msg)
+
+    # Streaming is supported for singular string and bytes fields which are not optional or part of a oneof.
+    @staticmethod
+    def is_streamed(proto_descriptor):
+        result = False
+        if (proto_descriptor.type in (FieldDescriptorProto.TYPE_STRING, FieldDescriptorProto.TYPE_BYTES)) \
+                and (FieldDescriptorProto.LABEL_REPEATED != proto_descriptor.label) \
+                and not proto_descriptor.proto3_optional \
+                and proto_descriptor.options.HasExtension(embedded_proto_options_pb2.options):
+            result = proto_descriptor.options.Extensions[embedded_proto_options_pb2.options].stream
+        return result
+
+    def get_type(self):
+        str_type = "::EmbeddedProto::FieldBytesStream<"
+        if self.MaxLength:
+            str_type += str(self.MaxLength) + ">"
+        else:
+            str_type += self.template_param_str + ">"
+        return str_type
+
+    def get_short_type(self):
+        return "FieldBytesStream"
+
+    def is_memberwise_copyable(self):
+        # Only the pointers to the source and sink are stored.
+        return True
+
+    def get_ram_size(self, pointer_size):
+        # The source and sink pointers.
+        return struct_layout([(pointer_size, pointer_size), (pointer_size, pointer_size)])
+
+    def render_get_set(self, jinja_env):
+        return self.render("FieldBytesStream_GetSet.h", jinja_environment=jinja_env)
+
+# -----------------------------------------------------------------------------
+
+
 # This class is used to wrap around any enum used as a field.
 class FieldEnum(Field):
     def __init__(self, proto_descriptor, parent_msg, oneof=None):
@@ -372,6 +629,19 @@ class FieldEnum(Field):
     def get_default_value(self):
         return "static_cast<" + self.get_type_as_defined() + ">(0)"
 
+    def get_alignment(self):
+        return self.definition.get_alignment()
+
+    def get_max_value_size(self):
+        # Enums are serialized as unsigned 32 bit varints.
+        return 5
+
+    def is_trivially_copyable(self):
+        return True
+
+    def get_ram_size(self, pointer_size):
+        return self.get_alignment(), self.get_alignment()
+
     def match_field_with_definitions(self, all_types_definitions):
         found = False
         my_type = self.get_type_as_defined()
@@ -399,12 +669,18 @@ class FieldEnum(Field):
 
 # This class is used to wrap around any type of message used as a field.
 class FieldMessage(Field):
-    def __init__(self, proto_descriptor, parent_msg, oneof=None):
+    def __init__(self, proto_descriptor, parent_msg, oneof=None, already_nested=False):
         super().__init__(proto_descriptor, parent_msg, "FieldMsg.h", oneof)
 
         # Reserve a member variable for the reference to the message definition used for this field.
         self.definition = None
 
+        # Lazy decoding is only supported for singular fields which are not part of a oneof.
+        self.lazy = False
+        if self.descriptor.options.HasExtension(embedded_proto_options_pb2.options):
+            self.lazy = self.descriptor.options.Extensions[embedded_proto_options_pb2.options].lazy \
+                        and (oneof is None) and not already_nested
+
     def get_wire_type_str(self):
         return "LENGTH_DELIMITED"
 
@@ -433,10 +709,47 @@ class FieldMessage(Field):
     def get_short_type(self):
         return self.get_type().split("::")[-1]
 
+    def get_member_type(self):
+        result = self.get_type()
+        if self.lazy:
+            result = "::EmbeddedProto::LazyMessage<" + result + ">"
+        return result
+
     def get_default_value(self):
         # Just call the default constructor.
         return ""
 
+    def get_alignment(self):
+        return self.definition.get_alignment()
+
+    def get_max_serialized_size_expression(self):
+        # Use the constant of the message as its member functions can not be called by an enclosing message.
+        return "::EmbeddedProto::WireFormatter::LengthDelimitedSize(static_cast<uint32_t>(FieldNumber::" + \
+               self.get_variable_id_name() + "), " + self.get_type() + "::MAX_SERIALIZED_SIZE)"
+
+    def get_max_value_size(self):
+        return self.definition.get_max_serialized_size()
+
+    def get_ram_size(self, pointer_size):
+        result = self.definition.get_ram_size(pointer_size)
+        if self.lazy and result:
+            # The message, the data pointer and size, two flags and the result of decoding.
+            result = struct_layout([result, (pointer_size, pointer_size), (4, 4), (1, 1), (1, 1), (4, 4)])
+        return result
+
+    def is_memberwise_copyable(self):
+        return self.definition.is_memberwise_copyable()
+
+    def is_movable(self):
+        return True
+
+    # Lazy fields copy the wrapper, this keeps bytes which have not been decoded yet.
+    def get_copy_source(self, move):
+        if self.lazy:
+            result = "rhs." + self.get_variable_name()
+            return "std::move(" + result + ")" if move else result
+        return super().get_copy_source(move)
+
     def get_template_parameters(self):
         # Get the template names used by the definition.
         templates = copy.deepcopy(self.definition.get_templates())
@@ -471,11 +784,27 @@ class FieldMessage(Field):
         return self.definition.scope.get()
 
     def render_get_set(self, jinja_env):
+        if self.lazy:
+            return self.render("FieldMsgLazy_GetSet.h", jinja_environment=jinja_env)
         return self.render("FieldMsg_GetSet.h", jinja_environment=jinja_env)
 
     def render_serialize(self, jinja_env):
         return self.render("FieldMsg_Serialize.h", jinja_environment=jinja_env)
 
+    # Lazy fields are always serialized and deserialized as a whole.
+    def has_field_mask(self):
+        return not self.lazy
+
+    def render_serialize_masked(self, jinja_env):
+        if self.lazy:
+            return self.render_serialize(jinja_env)
+        return self.render("FieldMsg_SerializeMasked.h", jinja_environment=jinja_env)
+
+    def render_deserialize_masked(self, jinja_env):
+        if self.lazy:
+            return self.render_deserialize(jinja_env)
+        return self.render("FieldMsg_DeserializeMasked.h", jinja_environment=jinja_env)
+
     def render_deserialize(self, jinja_env):
         return self.render("FieldMsg_Deserialize.h", jinja_environment=jinja_env)
 
@@ -495,14 +824,23 @@ class FieldRepeated(Field):
 
         # Find options we know and use in this type of field.
         self.MaxLength = None
+        # Streamed fields do not store their elements, they are obtained from a source and passed on to a sink.
+        self.stream = False
         if self.descriptor.options.HasExtension(embedded_proto_options_pb2.options):
             self.MaxLength = self.descriptor.options.Extensions[embedded_proto_options_pb2.options].maxLength
+            self.stream = self.descriptor.options.Extensions[embedded_proto_options_pb2.options].stream
 
     def get_wire_type_str(self):
         return "LENGTH_DELIMITED"
 
+    def is_repeated(self):
+        return True
+
     def get_type(self):
-        type_str = "::EmbeddedProto::RepeatedFieldFixedSize<" + self.actual_type.get_type() + ", "
+        if self.stream:
+            type_str = "::EmbeddedProto::RepeatedFieldStream<" + self.actual_type.get_type() + ", "
+        else:
+            type_str = "::EmbeddedProto::RepeatedFieldFixedSize<" + self.actual_type.get_type() + ", "
         if self.MaxLength:
             type_str += str(self.MaxLength) + ">"
         else:
@@ -510,12 +848,44 @@ class FieldRepeated(Field):
         return type_str
 
     def get_short_type(self):
-        type_str = "::EmbeddedProto::RepeatedFieldFixedSize<" + self.actual_type.get_type() + ", "
-        if self.MaxLength:
-            type_str += str(self.MaxLength) + ">"
-        else:
-            type_str += self.template_param_str + ">"
-        return type_str
+        return self.get_type()
+
+    def get_alignment(self):
+        if self.stream:
+            return POINTER_ALIGNMENT
+        return max(POINTER_ALIGNMENT, self.actual_type.get_alignment())
+
+    def is_memberwise_copyable(self):
+        # A stream only holds pointers to its source and sink.
+        return self.stream or self.actual_type.is_memberwise_copyable()
+
+    def is_movable(self):
+        return True
+
+    def get_max_serialized_size(self):
+        result = None
+        value_size = self.actual_type.get_max_value_size()
+        if self.MaxLength and (value_size is not None):
+            if "LENGTH_DELIMITED" == self.actual_type.get_wire_type_str():
+                # Unpacked, every element has its own tag and length.
+                result = self.MaxLength * self.actual_type.get_max_serialized_size()
+            else:
+                result = tag_size(self.variable_id) + varint_size(self.MaxLength * value_size) + \
+                         (self.MaxLength * value_size)
+        return result
+
+    def get_ram_size(self, pointer_size):
+        result = None
+        element = self.actual_type.get_ram_size(pointer_size)
+        if self.stream:
+            # The source and sink pointers and the number of elements received.
+            result = struct_layout([(pointer_size, pointer_size), (pointer_size, pointer_size), (4, 4)])
+        elif self.MaxLength and element:
+            # The virtual table, the current length and the data array.
+            element_size, element_alignment = element
+            result = struct_layout([(pointer_size, pointer_size), (4, 4),
+                                    (self.MaxLength * element_size, element_alignment)])
+        return result
 
     # As this is a repeated field we need a function to get the type we are repeating.
     def get_base_type(self):
@@ -539,6 +909,8 @@ class FieldRepeated(Field):
         return True
 
     def render_get_set(self, jinja_env):
+        if self.stream:
+            return self.render("FieldRepeatedStream_GetSet.h", jinja_environment=jinja_env)
         return self.render("FieldRepeated_GetSet.h", jinja_environment=jinja_env)
 
     def render_serialize(self, jinja_env):
@@ -561,6 +933,19 @@ class FieldErrorRecursive(Field):
     def get_type(self):
         return "//"
 
+    def get_alignment(self):
+        # No member variable is declared for this field.
+        return 1
+
+    def get_max_serialized_size_expression(self):
+        return None
+
+    def get_max_serialized_size(self):
+        return 0
+
+    def get_ram_size(self, pointer_size):
+        return 0, 1
+
     def render_get_set(self, jinja_env):
         return self.render("FieldErrorRecursive_GetSet.h", jinja_environment=jinja_env)
 
@@ -28,7 +28,7 @@
 #   the Netherlands
 #
 
-from .Field import Field
+from .Field import Field, struct_layout
 
 
 class Oneof:
@@ -58,6 +58,33 @@ class Oneof:
     def get_fields(self):
         return self.fields
 
+    # The estimated alignment of the union and the which variable in bytes. The latter is a 32 bit enum.
+    def get_alignment(self):
+        return max([4] + [field.get_alignment() for field in self.fields])
+
+    # The C++ expression calculating the maximum number of bytes of the largest field in this oneof.
+    def get_max_serialized_size_expression(self):
+        expressions = [field.get_max_serialized_size_expression() for field in self.fields]
+        result = expressions[-1]
+        for expression in reversed(expressions[:-1]):
+            result = "::EmbeddedProto::constexpr_max(" + expression + ",\n    " + result + ")"
+        return result
+
+    # The maximum number of bytes of the largest field in this oneof, None when this depends on template parameters.
+    def get_max_serialized_size(self):
+        sizes = [field.get_max_serialized_size() for field in self.fields]
+        return None if None in sizes else max(sizes)
+
+    # The estimated size and alignment of the which variable and the union, None when this depends on template
+    # parameters.
+    def get_ram_size(self, pointer_size):
+        result = None
+        sizes = [field.get_ram_size(pointer_size) for field in self.fields]
+        if None not in sizes:
+            union = struct_layout([(max([size for size, _ in sizes]), max([alignment for _, alignment in sizes]))])
+            result = struct_layout([(4, 4), union])
+        return result
+
     def match_field_with_definitions(self, all_types_definitions):
         for field in self.fields:
             field.match_field_with_definitions(all_types_definitions)
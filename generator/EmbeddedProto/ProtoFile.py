@@ -29,6 +29,7 @@
 #
 
 from .TypeDefinitions import *
+from . import embedded_proto_options_pb2
 import os
 from toposort import CircularDependencyError, toposort_flatten
 from google.protobuf.descriptor_pb2 import FieldDescriptorProto
@@ -92,8 +93,14 @@ class ProtoFile:
             for package in package_list[1:]:
                 self.scope = Scope(package, self.scope)
 
-        self.enum_definitions = [EnumDefinition(enum, self.scope) for enum in self.descriptor.enum_type]
-        self.msg_definitions = [MessageDefinition(msg, self.scope) for msg in self.descriptor.message_type]
+        # Find options we know and use in this file.
+        compact_layout = False
+        if self.descriptor.options.HasExtension(embedded_proto_options_pb2.file_options):
+            compact_layout = self.descriptor.options.Extensions[embedded_proto_options_pb2.file_options].compactLayout
+
+        self.enum_definitions = [EnumDefinition(enum, self.scope, compact_layout) for enum in self.descriptor.enum_type]
+        self.msg_definitions = [MessageDefinition(msg, self.scope, compact_layout)
+                                for msg in self.descriptor.message_type]
 
         self.all_parameters_registered = False
 
@@ -180,6 +187,10 @@ class ProtoFile:
         file_str = template.render(proto_file=self, environment=jinja_environment)
         return file_str
 
+    def render_report(self, jinja_environment):
+        template = jinja_environment.get_template("Report.txt")
+        return template.render(proto_file=self, messages=self.get_all_nested_types()["messages"])
+
     def print_template_data(self, indent):
         print(indent + "File: " + self.filename_without_folder)
         if self.msg_definitions:
@@ -28,8 +28,9 @@
 #   the Netherlands
 #
 
-from .Field import Field
+from .Field import Field, POINTER_ALIGNMENT, struct_layout
 from .Oneof import Oneof
+from . import embedded_proto_options_pb2
 import jinja2
 
 
@@ -111,23 +112,54 @@ class TypeDefinition:
 # -----------------------------------------------------------------------------
 
 class EnumDefinition(TypeDefinition):
-    def __init__(self, proto_descriptor, parent_scope):
+    def __init__(self, proto_descriptor, parent_scope, compact_layout=False):
         super().__init__(proto_descriptor, parent_scope, "TypeDefEnum.h")
 
+        # Proto3 enums are open, values not defined in the proto file are stored as well. The underlying type therefore
+        # always holds all 32 bit values. In a compact layout a signed type is used when there are negative values.
+        self.underlying_type = "uint32_t"
+        if compact_layout and min([value.number for value in self.values()]) < 0:
+            self.underlying_type = "int32_t"
+
     # Loop through the values defined in the enum.
     def values(self):
         for value in self.descriptor.value:
             yield value
 
+    def get_underlying_type(self):
+        return self.underlying_type
+
+    def get_alignment(self):
+        return 4
+
 
 # -----------------------------------------------------------------------------
 
 class MessageDefinition(TypeDefinition):
-    def __init__(self, proto_descriptor, parent_scope):
+    def __init__(self, proto_descriptor, parent_scope, compact_layout=False):
         super().__init__(proto_descriptor, parent_scope, "TypeDefMsg.h")
 
-        self.nested_enum_definitions = [EnumDefinition(enum, self.scope) for enum in self.descriptor.enum_type]
-        self.nested_msg_definitions = [MessageDefinition(msg, self.scope) for msg in self.descriptor.nested_type]
+        # Find options we know and use in this message. The compact layout is inherited from the file or parent message.
+        self.compact_layout = compact_layout
+        self.alignment = None
+        self.track_changes = False
+        if self.descriptor.options.HasExtension(embedded_proto_options_pb2.msg_options):
+            msg_options = self.descriptor.options.Extensions[embedded_proto_options_pb2.msg_options]
+            self.compact_layout = self.compact_layout or msg_options.compactLayout
+            self.track_changes = msg_options.trackChanges
+            if msg_options.alignment:
+                if msg_options.alignment & (msg_options.alignment - 1):
+                    raise Exception("The alignment of message " + self.name + " should be a power of two.")
+                # An alignas(N) below the natural alignment of the class is ill-formed. Each message has a virtual table
+                # pointer, so the alignment should be at least the size of a pointer on a 64 bit target.
+                if msg_options.alignment < 8:
+                    raise Exception("The alignment of message " + self.name + " should be at least 8 bytes.")
+                self.alignment = msg_options.alignment
+
+        self.nested_enum_definitions = [EnumDefinition(enum, self.scope, self.compact_layout)
+                                        for enum in self.descriptor.enum_type]
+        self.nested_msg_definitions = [MessageDefinition(msg, self.scope, self.compact_layout)
+                                       for msg in self.descriptor.nested_type]
 
         # Store the id numbers of all the fields to create the ID enum.
         self.field_ids = []
@@ -135,6 +167,10 @@ class MessageDefinition(TypeDefinition):
         # This message contains optional fields, or not.
         self.optional_fields = []
 
+        # The names of the bits in the presence array. These are the presence flags of optional fields and, in a compact
+        # layout, the values of boolean fields.
+        self.bit_flags = []
+
         # Store all the variable fields in this message.
         self.fields = []
         for f in self.descriptor.field:
@@ -146,6 +182,10 @@ class MessageDefinition(TypeDefinition):
                 # Store for which fields presence needs to be tracked.
                 if f.proto3_optional:
                     self.optional_fields.append(new_field)
+                    self.bit_flags.append(new_field.get_variable_id_name())
+
+                if new_field.bit_packed:
+                    self.bit_flags.append(new_field.get_value_bit_name())
 
         # Store all the oneof definitions in this message.
         self.oneofs = []
@@ -243,6 +283,86 @@ class MessageDefinition(TypeDefinition):
     def get_type(self):
         return self.scope.get_scope_str()
 
+    # The type used for the presence array. In a compact layout the smallest type holding all bits is used.
+    def get_bit_flags_type(self):
+        result = "uint32_t"
+        if self.compact_layout:
+            if 8 >= len(self.bit_flags):
+                result = "uint8_t"
+            elif 16 >= len(self.bit_flags):
+                result = "uint16_t"
+        return result
+
+    # Obtain the member variables as a list of tuples with the kind of member and the object: ("presence", self),
+    # ("field", field) or ("oneof", oneof). In a compact layout the members are sorted by decreasing alignment to
+    # minimize the padding between them. Otherwise they are declared in the order of the proto file.
+    def get_member_variables(self):
+        members = []
+        if self.bit_flags:
+            members.append(("presence", self))
+        members.extend([("field", field) for field in self.fields if not field.bit_packed])
+        members.extend([("oneof", oneof) for oneof in self.oneofs])
+        if self.compact_layout:
+            members.sort(key=self.get_member_alignment, reverse=True)
+        return members
+
+    # The alignment of one of the member variables as returned by get_member_variables.
+    def get_member_alignment(self, member):
+        kind, member_object = member
+        if "presence" == kind:
+            result = {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}[self.get_bit_flags_type()]
+        else:
+            result = member_object.get_alignment()
+        return result
+
+    # The estimated alignment of this message when used as a field in an other message.
+    def get_alignment(self):
+        alignments = [POINTER_ALIGNMENT]
+        alignments.extend([self.get_member_alignment(member) for member in self.get_member_variables()])
+        if self.alignment:
+            alignments.append(self.alignment)
+        return max(alignments)
+
+    # Can the special member functions of this message be defaulted. This is the case when all fields are scalars, enums,
+    # arrays of those or nested messages for which this holds as well. Only scalars and enums are allowed in oneofs as
+    # the union can only be copied as a whole when all its members are trivially copyable.
+    def is_memberwise_copyable(self):
+        result = all([field.is_memberwise_copyable() for field in self.fields])
+        for oneof in self.oneofs:
+            result = result and all([field.is_trivially_copyable() for field in oneof.get_fields()])
+        return result
+
+    # The C++ expressions of which the sum is the maximum number of bytes this message takes when serialized.
+    def get_max_serialized_size_expressions(self):
+        expressions = [field.get_max_serialized_size_expression() for field in self.fields]
+        expressions.extend([oneof.get_max_serialized_size_expression() for oneof in self.oneofs])
+        return [expression for expression in expressions if expression]
+
+    # The maximum number of bytes this message takes when serialized, None when this depends on template parameters.
+    def get_max_serialized_size(self):
+        sizes = [field.get_max_serialized_size() for field in self.fields]
+        sizes.extend([oneof.get_max_serialized_size() for oneof in self.oneofs])
+        return None if None in sizes else sum(sizes)
+
+    # The estimated size and alignment of this message for the given pointer size, None when this depends on template
+    # parameters.
+    def get_ram_size(self, pointer_size):
+        result = None
+        # Start with the virtual table.
+        members = [(pointer_size, pointer_size)]
+        for kind, member in self.get_member_variables():
+            if "presence" == kind:
+                alignment = self.get_member_alignment((kind, member))
+                members.append((alignment * -(-len(self.bit_flags) // (8 * alignment)), alignment))
+            else:
+                members.append(member.get_ram_size(pointer_size))
+
+        if None not in members:
+            if self.alignment:
+                members.append((0, self.alignment))
+            result = struct_layout(members)
+        return result
+
     def print_template_data(self, indent):
         print(indent + "Message definition: " + self.name)
         if self.nested_msg_definitions:
@@ -99,6 +99,14 @@ def generate_code(request, respones):
         else:
             break
 
+    # When requested with --eams_opt=report add a text file per proto file listing the maximum wire size and estimated
+    # RAM footprint of each message.
+    if "report" in request.parameter.split(","):
+        for fd in file_definitions:
+            f = respones.file.add()
+            f.name = fd.filename_with_folder + "_report.txt"
+            f.content = fd.render_report(template_env)
+
 
 # -----------------------------------------------------------------------------
 
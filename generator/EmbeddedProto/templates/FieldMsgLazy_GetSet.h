@@ -0,0 +1,98 @@
+{#
+Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+
+This file is part of Embedded Proto.
+
+Embedded Proto is open source software: you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation, version 3 of the license.
+
+Embedded Proto  is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+
+For commercial and closed source application please visit:
+<https://EmbeddedProto.com/license/>.
+
+Embedded AMS B.V.
+Info:
+  info at EmbeddedProto dot com
+
+Postal address:
+  Atoomweg 2
+  1627 LE, Hoorn
+  the Netherlands
+#}
+static constexpr char const* {{field.get_name()|upper}}_NAME = "{{field.get_name()}}";
+{% if field.optional %}
+inline bool has_{{field.get_name()}}() const
+{
+  return 0 != (presence::mask(presence::fields::{{field.get_name().upper()}}) & presence_[presence::index(presence::fields::{{field.get_name().upper()}})]);
+}
+inline void clear_{{field.get_name()}}()
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] &= ~(presence::mask(presence::fields::{{field.get_name().upper()}}));
+  {{field.get_variable_name()}}.clear();
+}
+inline void set_{{field.get_name()}}(const {{field.get_type()}}& value)
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] |= presence::mask(presence::fields::{{field.get_name().upper()}});
+  {{field.get_variable_name()}} = value;
+}
+inline void set_{{field.get_name()}}({{field.get_type()}}&& value)
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] |= presence::mask(presence::fields::{{field.get_name().upper()}});
+  {{field.get_variable_name()}} = std::move(value);
+}
+// Copy the field including any bytes which have not been decoded yet, used when copying the message.
+inline void set_{{field.get_name()}}(const {{field.get_member_type()}}& value)
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] |= presence::mask(presence::fields::{{field.get_name().upper()}});
+  {{field.get_variable_name()}} = value;
+}
+inline void set_{{field.get_name()}}({{field.get_member_type()}}&& value)
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] |= presence::mask(presence::fields::{{field.get_name().upper()}});
+  {{field.get_variable_name()}} = std::move(value);
+}
+inline {{field.get_type()}}& mutable_{{field.get_name()}}()
+{
+  {% if field.tracks_changes() %}
+  changed_.set(FieldNumber::{{field.get_variable_id_name()}});
+  {% endif %}
+  presence_[presence::index(presence::fields::{{field.get_name().upper()}})] |= presence::mask(presence::fields::{{field.get_name().upper()}});
+  return {{field.get_variable_name()}}.get_mutable();
+}
+{% else %}
+inline void clear_{{field.get_name()}}() { {{field.get_mark_changed()}}{{field.get_variable_name()}}.clear(); }
+inline void set_{{field.get_name()}}(const {{field.get_type()}}& value) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = value; }
+inline void set_{{field.get_name()}}({{field.get_type()}}&& value) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = std::move(value); }
+// Copy the field including any bytes which have not been decoded yet, used when copying the message.
+inline void set_{{field.get_name()}}(const {{field.get_member_type()}}& value) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = value; }
+inline void set_{{field.get_name()}}({{field.get_member_type()}}&& value) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = std::move(value); }
+inline {{field.get_type()}}& mutable_{{field.get_name()}}() { {{field.get_mark_changed()}}return {{field.get_variable_name()}}.get_mutable(); }
+{% endif %}
+// The nested message is decoded on first access, decode_{{field.get_name()}}() returns the result of decoding.
+inline ::EmbeddedProto::Error decode_{{field.get_name()}}() const { return {{field.get_variable_name()}}.decode(); }
+inline const {{field.get_type()}}& get_{{field.get_name()}}() const { return {{field.get_variable_name()}}.get(); }
+inline const {{field.get_type()}}& get_{{field.get_name()}}(::EmbeddedProto::Error& result) const { return {{field.get_variable_name()}}.get(result); }
+inline const {{field.get_type()}}& {{field.get_name()}}() const { return {{field.get_variable_name()}}.get(); }
@@ -0,0 +1,57 @@
+{#
+Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+
+This file is part of Embedded Proto.
+
+Embedded Proto is open source software: you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation, version 3 of the license.
+
+Embedded Proto  is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+
+For commercial and closed source application please visit:
+<https://EmbeddedProto.com/license/>.
+
+Embedded AMS B.V.
+Info:
+  info at EmbeddedProto dot com
+
+Postal address:
+  Atoomweg 2
+  1627 LE, Hoorn
+  the Netherlands
+#}
+if(mask.get_{{field.get_name()}}().none())
+{
+  {{ field.render_serialize(environment)|indent(2) }}
+}
+else
+{
+  // Only serialize the fields of the nested message selected in the nested mask.
+  {% if (field.optional or (field.oneof is not none)) %}
+  if(has_{{field.get_name()}}() && (::EmbeddedProto::Error::NO_ERRORS == return_value))
+  {
+    const uint32_t size_x = {{field.get_variable_name()}}.serialized_size(mask.get_{{field.get_name()}}());
+  {% else %}
+  // As with serialize(), an empty nested message is omitted.
+  const uint32_t size_x = {{field.get_variable_name()}}.serialized_size(mask.get_{{field.get_name()}}());
+  if((0 < size_x) && (::EmbeddedProto::Error::NO_ERRORS == return_value))
+  {
+  {% endif %}
+    return_value = ::EmbeddedProto::WireFormatter::SerializeVarint(::EmbeddedProto::WireFormatter::MakeTag(static_cast<uint32_t>(FieldNumber::{{field.get_variable_id_name()}}), ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED), buffer);
+    if(::EmbeddedProto::Error::NO_ERRORS == return_value)
+    {
+      return_value = ::EmbeddedProto::WireFormatter::SerializeVarint(size_x, buffer);
+    }
+    if((::EmbeddedProto::Error::NO_ERRORS == return_value) && (0 < size_x))
+    {
+      return_value = {{field.get_variable_name()}}.serialize(buffer, mask.get_{{field.get_name()}}());
+    }
+  }
+}
@@ -0,0 +1,40 @@
+{#
+Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+
+This file is part of Embedded Proto.
+
+Embedded Proto is open source software: you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation, version 3 of the license.
+
+Embedded Proto  is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+
+For commercial and closed source application please visit:
+<https://EmbeddedProto.com/license/>.
+
+Embedded AMS B.V.
+Info:
+  info at EmbeddedProto dot com
+
+Postal address:
+  Atoomweg 2
+  1627 LE, Hoorn
+  the Netherlands
+#}
+static constexpr char const* {{field.get_name()|upper}}_NAME = "{{field.get_name()}}";
+// The elements of {{field.get_name()}} are not stored in the message. They are obtained from the source when serializing
+// and passed to the sink when deserializing.
+inline void clear_{{field.get_name()}}() { {{field.get_mark_changed()}}{{field.get_variable_name()}}.clear(); }
+inline void set_{{field.get_name()}}_source(const ::EmbeddedProto::RepeatedFieldSource<{{field.get_base_type()}}>* source) { {{field.get_mark_changed()}}{{field.get_variable_name()}}.set_source(source); }
+inline void set_{{field.get_name()}}_sink(::EmbeddedProto::RepeatedFieldSink<{{field.get_base_type()}}>* sink) { {{field.get_variable_name()}}.set_sink(sink); }
+inline void set_{{field.get_name()}}(const {{field.get_type()}}& values) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = values; }
+inline void set_{{field.get_name()}}({{field.get_type()}}&& values) { {{field.get_mark_changed()}}{{field.get_variable_name()}} = std::move(values); }
+inline {{field.get_type()}}& mutable_{{field.get_name()}}() { {{field.get_mark_changed()}}return {{field.get_variable_name()}}; }
+inline const {{field.get_type()}}& get_{{field.get_name()}}() const { return {{field.get_variable_name()}}; }
+inline const {{field.get_type()}}& {{field.get_name()}}() const { return {{field.get_variable_name()}}; }
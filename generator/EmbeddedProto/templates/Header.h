@@ -43,11 +43,17 @@
 #include <Fields.h>
 #include <MessageSizeCalculator.h>
 #include <ReadBufferSection.h>
+#include <ReadBufferView.h>
 #include <RepeatedFieldFixedSize.h>
+#include <RepeatedFieldStream.h>
+#include <FieldBytesStream.h>
 #include <FieldStringBytes.h>
+#include <LazyMessage.h>
 #include <Errors.h>
 #include <Defines.h>
+#include <Hash.h>
 #include <limits>
+#include <functional>
 
 {% endif %}
 {% if proto_file.get_dependencies() is defined %}
@@ -72,4 +78,21 @@ namespace {{ namespace }} {
 {% for namespace in proto_file.get_namespaces()|reverse %}
 } // End of namespace {{ namespace }}
 {% endfor %}
+{% if proto_file.msg_definitions %}
+
+namespace std {
+
+{% set scope = "::" ~ proto_file.get_namespaces()|join("::") if proto_file.get_namespaces() else "" %}
+{% for msg in proto_file.msg_definitions %}
+{% set msg_type = scope ~ "::" ~ msg.get_name() ~ ("<" ~ msg.get_templates()|map(attribute='name')|join(", ") ~ ">" if msg.get_templates()) %}
+template<{% for tmpl_param in msg.get_templates() %}{{tmpl_param['type']}} {{tmpl_param['name']}}{{", " if not loop.last}}{% endfor %}>
+struct hash<{{ msg_type }}>
+{
+  size_t operator()(const {{ msg_type }}& msg) const { return static_cast<size_t>(msg.hash()); }
+};
+
+{% endfor %}
+} // End of namespace std
+
+{% endif %}
 #endif // {{proto_file.get_header_guard()}}_H
@@ -27,7 +27,7 @@ Postal address:
   1627 LE, Hoorn
   the Netherlands
 #}
-enum class {{ typedef.name }} : uint32_t
+enum class {{ typedef.name }} : {{ typedef.get_underlying_type() }}
 {
   {% for value in typedef.values() %}
   {{ value.name }} = {{ value.number }}{{ "," if not loop.last }}
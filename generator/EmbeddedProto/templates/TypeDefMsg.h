@@ -31,17 +31,22 @@ Postal address:
 {% for tmpl_param in typedef.get_templates() %}
 {{"template<\n" if loop.first}}    {{tmpl_param['type']}} {{tmpl_param['name']}}{{", " if not loop.last}}{{"\n>" if loop.last}}
 {% endfor %}
-class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
+class {{ "alignas(" ~ typedef.alignment ~ ") " if typedef.alignment }}{{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
 {
   public:
     {{ typedef.get_name() }}() = default;
+    {% if typedef.is_memberwise_copyable() %}
+    // This message only holds scalars, enums and arrays of them which are copied as a block of memory.
+    {{ typedef.get_name() }}(const {{typedef.get_name()}}& rhs) = default;
+    {{ typedef.get_name() }}({{typedef.get_name()}}&& rhs) = default;
+    {% else %}
     {{ typedef.get_name() }}(const {{typedef.get_name()}}& rhs )
     {
       {% for field in typedef.fields %}
       {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
       if(rhs.has_{{field.get_name()}}())
       {
-        set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+        set_{{ field.get_name() }}({{ field.get_copy_source(false) }});
       }
       else
       {
@@ -49,7 +54,7 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       }
 
       {% else %}
-      set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+      set_{{ field.get_name() }}({{ field.get_copy_source(false) }});
       {% endif %}
       {% endfor %}
       {% for oneof in typedef.oneofs %}
@@ -57,13 +62,13 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       {% endfor %}
     }
 
-    {{ typedef.get_name() }}(const {{typedef.get_name()}}&& rhs ) noexcept
+    {{ typedef.get_name() }}({{typedef.get_name()}}&& rhs) noexcept
     {
       {% for field in typedef.fields %}
       {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
       if(rhs.has_{{field.get_name()}}())
       {
-        set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+        set_{{ field.get_name() }}({{ field.get_copy_source(true) }});
       }
       else
       {
@@ -71,13 +76,14 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       }
 
       {% else %}
-      set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+      set_{{ field.get_name() }}({{ field.get_copy_source(true) }});
       {% endif %}
       {% endfor %}
       {% for oneof in typedef.oneofs %}
-      {{ TypeOneof.assign(oneof)|indent(6) }}
+      {{ TypeOneof.assign(oneof, true)|indent(6) }}
       {% endfor %}
     }
+    {% endif %}
 
     ~{{ typedef.get_name() }}() override = default;
 
@@ -97,13 +103,132 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       {% endfor %}
     };
 
+    // The maximum number of bytes this message takes when serialized.
+    static constexpr uint32_t MAX_SERIALIZED_SIZE = 0
+    {% for expression in typedef.get_max_serialized_size_expressions() %}
+        + {{ expression|indent(10) }}
+    {% endfor %}
+        ;
+
+    // Select a subset of the fields of this message to serialize. Message fields have a nested mask to select
+    // the fields of the nested message. When no fields are selected in a nested mask the whole nested message is used.
+    class FieldMask
+    {
+      public:
+        FieldMask() = default;
+        ~FieldMask() = default;
+
+        // Select or deselect the given field.
+        void set(const FieldNumber field, const bool selected = true)
+        {
+          const uint32_t bit = to_bit(field);
+          if(N_FIELDS <= bit)
+          {
+            // Not a field of this message.
+          }
+          else if(selected)
+          {
+            selection_[bit / N_BITS] |= (static_cast<uint32_t>(0x01) << (bit % N_BITS));
+          }
+          else
+          {
+            selection_[bit / N_BITS] &= ~(static_cast<uint32_t>(0x01) << (bit % N_BITS));
+          }
+        }
+
+        // Check if the given field is selected.
+        bool is_set(const FieldNumber field) const
+        {
+          const uint32_t bit = to_bit(field);
+          return (N_FIELDS > bit) && (0 != (selection_[bit / N_BITS] & (static_cast<uint32_t>(0x01) << (bit % N_BITS))));
+        }
+
+        // Select all fields, the nested masks are left as is.
+        void set_all()
+        {
+          {% for id_set in typedef.field_ids %}
+          set(FieldNumber::{{id_set[1]}});
+          {% endfor %}
+        }
+
+        // Returns true when no field is selected.
+        bool none() const
+        {
+          bool result = true;
+          for(uint32_t i = 0; (i < SIZE) && result; ++i)
+          {
+            result = 0 == selection_[i];
+          }
+          return result;
+        }
+
+        // Returns true when all fields selected in other are also selected in this mask.
+        bool contains(const FieldMask& other) const
+        {
+          bool result = true;
+          for(uint32_t i = 0; (i < SIZE) && result; ++i)
+          {
+            result = 0 == (other.selection_[i] & ~selection_[i]);
+          }
+          return result;
+        }
+
+        {% for field in typedef.fields + typedef.oneofs|map(attribute='fields')|sum(start=[]) %}
+        {% if field.has_field_mask() %}
+        typename {{field.get_type()}}::FieldMask& mutable_{{field.get_name()}}() { return mask_{{field.get_name()}}_; }
+        const typename {{field.get_type()}}::FieldMask& get_{{field.get_name()}}() const { return mask_{{field.get_name()}}_; }
+
+        {% endif %}
+        {% endfor %}
+      private:
+
+        // The number of fields in this message.
+        static constexpr uint32_t N_FIELDS = {{typedef.field_ids|length}};
+
+        // The number of bits in a single selection variable.
+        static constexpr uint32_t N_BITS = std::numeric_limits<uint32_t>::digits;
+
+        // How many variables are required to hold a bit for each field.
+        static constexpr uint32_t SIZE = (0 == N_FIELDS) ? 1 : ((N_FIELDS / N_BITS) + ((N_FIELDS % N_BITS) > 0 ? 1 : 0));
+
+        // Convert the field number into the index of the bit used for it. Unknown fields return N_FIELDS.
+        static uint32_t to_bit(const FieldNumber field)
+        {
+          uint32_t bit = N_FIELDS;
+          switch(field)
+          {
+            {% for id_set in typedef.field_ids %}
+            case FieldNumber::{{id_set[1]}}:
+              bit = {{loop.index0}};
+              break;
+
+            {% endfor %}
+            default:
+              break;
+          }
+          return bit;
+        }
+
+        uint32_t selection_[SIZE] = {0};
+
+        {% for field in typedef.fields + typedef.oneofs|map(attribute='fields')|sum(start=[]) %}
+        {% if field.has_field_mask() %}
+        typename {{field.get_type()}}::FieldMask mask_{{field.get_name()}}_;
+        {% endif %}
+        {% endfor %}
+    };
+
+    {% if typedef.is_memberwise_copyable() %}
+    {{ typedef.name }}& operator=(const {{ typedef.name }}& rhs) = default;
+    {{ typedef.name }}& operator=({{ typedef.name }}&& rhs) = default;
+    {% else %}
     {{ typedef.name }}& operator=(const {{ typedef.name }}& rhs)
     {
       {% for field in typedef.fields %}
       {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
       if(rhs.has_{{field.get_name()}}())
       {
-        set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+        set_{{ field.get_name() }}({{ field.get_copy_source(false) }});
       }
       else
       {
@@ -111,7 +236,7 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       }
 
       {% else %}
-      set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+      set_{{ field.get_name() }}({{ field.get_copy_source(false) }});
       {% endif %}
       {% endfor %}
       {% for oneof in typedef.oneofs %}
@@ -120,13 +245,13 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       return *this;
     }
 
-    {{ typedef.name }}& operator=(const {{ typedef.name }}&& rhs) noexcept
+    {{ typedef.name }}& operator=({{ typedef.name }}&& rhs) noexcept
     {
       {% for field in typedef.fields %}
       {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
       if(rhs.has_{{field.get_name()}}())
       {
-        set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+        set_{{ field.get_name() }}({{ field.get_copy_source(true) }});
       }
       else
       {
@@ -134,14 +259,15 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       }
       
       {% else %}
-      set_{{ field.get_name() }}(rhs.get_{{ field.get_name() }}());
+      set_{{ field.get_name() }}({{ field.get_copy_source(true) }});
       {% endif %}
       {% endfor %}
       {% for oneof in typedef.oneofs %}
-      {{ TypeOneof.assign(oneof)|indent(6) }}
+      {{ TypeOneof.assign(oneof, true)|indent(6) }}
       {% endfor %}
       return *this;
     }
+    {% endif %}
 
     {% for field in typedef.fields %}
     {{ field.render_get_set(environment)|indent(4) }}
@@ -155,8 +281,83 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
 
     {% endfor %}
     {% endfor %}
+    {% set has_content = (typedef.fields|length > 0) or (typedef.oneofs|length > 0) %}
+    // Compare the content of two messages field by field. Only the elements in use of strings, bytes and repeated
+    // fields are compared. Optional fields are equal when both are not set or both are set to the same value.
+    bool operator==(const {{ typedef.name }}&{{ " rhs" if has_content }}) const
+    {
+      bool equal = true;
+      {% for field in typedef.fields %}
+      {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
+      equal = equal && (has_{{field.get_name()}}() == rhs.has_{{field.get_name()}}()) && 
+              (!has_{{field.get_name()}}() || (get_{{field.get_name()}}() == rhs.get_{{field.get_name()}}()));
+      {% else %}
+      equal = equal && (get_{{field.get_name()}}() == rhs.get_{{field.get_name()}}());
+      {% endif %}
+      {% endfor %}
+      {% for oneof in typedef.oneofs %}
+      equal = equal && (get_which_{{oneof.get_name()}}() == rhs.get_which_{{oneof.get_name()}}());
+      if(equal)
+      {
+        switch(get_which_{{oneof.get_name()}}())
+        {
+          {% for field in oneof.get_fields() %}
+          case FieldNumber::{{field.variable_id_name}}:
+            equal = (get_{{field.get_name()}}() == rhs.get_{{field.get_name()}}());
+            break;
+
+          {% endfor %}
+          default:
+            break;
+        }
+      }
+      {% endfor %}
+      return equal;
+    }
+
+    bool operator!=(const {{ typedef.name }}& rhs) const { return !(*this == rhs); }
+
+    // Calculate a hash of the content of this message without serializing it. Messages which are equal have the
+    // same hash.
+    uint64_t hash(const uint64_t seed = ::EmbeddedProto::Hash::SEED) const
+    {
+      uint64_t result = seed;
+      {% for field in typedef.fields %}
+      {% if typedef.optional_fields is defined and field in typedef.optional_fields %}
+      result = ::EmbeddedProto::Hash::value(result, has_{{field.get_name()}}());
+      if(has_{{field.get_name()}}())
+      {
+        result = ::EmbeddedProto::Hash::value(result, get_{{field.get_name()}}());
+      }
+      {% else %}
+      result = ::EmbeddedProto::Hash::value(result, get_{{field.get_name()}}());
+      {% endif %}
+      {% endfor %}
+      {% for oneof in typedef.oneofs %}
+      result = ::EmbeddedProto::Hash::value(result, get_which_{{oneof.get_name()}}());
+      switch(get_which_{{oneof.get_name()}}())
+      {
+        {% for field in oneof.get_fields() %}
+        case FieldNumber::{{field.variable_id_name}}:
+          result = ::EmbeddedProto::Hash::value(result, get_{{field.get_name()}}());
+          break;
+
+        {% endfor %}
+        default:
+          break;
+      }
+      {% endfor %}
+      return ::EmbeddedProto::Hash::finalize(result);
+    }
 
     ::EmbeddedProto::Error serialize(::EmbeddedProto::WriteBufferInterface& buffer) const override
+    {
+      return serialize<::EmbeddedProto::WriteBufferInterface>(buffer);
+    }
+
+    // Serialize using the concrete buffer type. This allows the compiler to inline the buffer calls.
+    template<class BUFFER_TYPE>
+    ::EmbeddedProto::Error serialize(BUFFER_TYPE& buffer) const
     {
       ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
 
@@ -181,7 +382,117 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       return return_value;
     };
 
+    // Serialize only the fields selected in the mask.
+    template<class BUFFER_TYPE>
+    ::EmbeddedProto::Error serialize(BUFFER_TYPE& buffer, const FieldMask& mask) const
+    {
+      ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+
+      {% for field in typedef.fields %}
+      if(mask.is_set(FieldNumber::{{field.get_variable_id_name()}}))
+      {
+        {{ field.render_serialize_masked(environment)|indent(8) }}
+      }
+
+      {% endfor %}
+      {% for oneof in typedef.oneofs %}
+      switch({{oneof.get_which_oneof()}})
+      {
+        {% for field in oneof.get_fields() %}
+        case FieldNumber::{{field.variable_id_name}}:
+          if(mask.is_set(FieldNumber::{{field.get_variable_id_name()}}))
+          {
+            {{ field.render_serialize_masked(environment)|indent(12) }}
+          }
+          break;
+
+        {% endfor %}
+        default:
+          break;
+      }
+
+      {% endfor %}
+      return return_value;
+    }
+
+    using ::EmbeddedProto::MessageInterface::serialized_size;
+
+    // Calculate the number of bytes required to serialize the fields selected in the mask.
+    uint32_t serialized_size(const FieldMask& mask) const
+    {
+      ::EmbeddedProto::MessageSizeCalculator calcBuffer;
+      this->serialize(calcBuffer, mask);
+      return calcBuffer.get_size();
+    }
+
+    {% if typedef.track_changes %}
+    // Serialize only the fields changed since the last call to mark_clean(). Changed scalar, enum, string and bytes
+    // fields are also serialized when they hold the default value. A receiver merging the data with deserialize()
+    // then ends up with the same values for these fields. Other changes can not be expressed as a merge:
+    // - Nested messages are serialized as usual, nested fields reset to their default are left out and the receiver
+    //   keeps the old value.
+    // - Repeated fields are serialized as a whole and are appended to the elements of the receiver.
+    // - Clearing an optional field or a oneof writes nothing, the receiver keeps the old value.
+    // Send the whole message when such changes have been made.
+    template<class BUFFER_TYPE>
+    ::EmbeddedProto::Error serialize_changed(BUFFER_TYPE& buffer) const
+    {
+      ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+
+      {% for field in typedef.fields %}
+      if(changed_.is_set(FieldNumber::{{field.get_variable_id_name()}}))
+      {
+        {{ field.render_serialize_changed(environment)|indent(8) }}
+      }
+
+      {% endfor %}
+      {% for oneof in typedef.oneofs %}
+      switch({{oneof.get_which_oneof()}})
+      {
+        {% for field in oneof.get_fields() %}
+        case FieldNumber::{{field.variable_id_name}}:
+          if(changed_.is_set(FieldNumber::{{field.get_variable_id_name()}}))
+          {
+            {{ field.render_serialize_changed(environment)|indent(12) }}
+          }
+          break;
+
+        {% endfor %}
+        default:
+          break;
+      }
+
+      {% endfor %}
+      return return_value;
+    }
+
+    // Calculate the number of bytes serialize_changed() will write.
+    uint32_t serialized_size_changed() const
+    {
+      ::EmbeddedProto::MessageSizeCalculator calcBuffer;
+      this->serialize_changed(calcBuffer);
+      return calcBuffer.get_size();
+    }
+
+    // Returns true when a field has been changed since the last call to mark_clean().
+    bool is_changed() const { return !changed_.none(); }
+
+    // The fields changed since the last call to mark_clean().
+    const FieldMask& get_changed() const { return changed_; }
+
+    // Forget all changes, for example after they have been send.
+    void mark_clean() { changed_ = FieldMask(); }
+
+    {% endif %}
+
     ::EmbeddedProto::Error deserialize(::EmbeddedProto::ReadBufferInterface& buffer) override
+    {
+      return deserialize<::EmbeddedProto::ReadBufferInterface>(buffer);
+    }
+
+    // Deserialize using the concrete buffer type. This allows the compiler to inline the buffer calls.
+    template<class BUFFER_TYPE>
+    ::EmbeddedProto::Error deserialize(BUFFER_TYPE& buffer)
     {
       ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
       ::EmbeddedProto::WireFormatter::WireType wire_type = ::EmbeddedProto::WireFormatter::WireType::VARINT;
@@ -235,6 +546,204 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       return return_value;
     };
 
+    // Deserialize only the fields selected in the mask, all other fields are skipped without decoding them. When none
+    // of the selected fields are repeated, reading stops as soon as each selected field has been found. The rest of the
+    // buffer is then left unread and later occurrences of the selected fields are ignored.
+    template<class BUFFER_TYPE>
+    ::EmbeddedProto::Error deserialize(BUFFER_TYPE& buffer, const FieldMask& mask)
+    {
+      ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+      ::EmbeddedProto::WireFormatter::WireType wire_type = ::EmbeddedProto::WireFormatter::WireType::VARINT;
+      uint32_t id_number = 0;
+      FieldNumber id_tag = FieldNumber::NOT_SET;
+
+      // Keep track of which selected fields have been found.
+      FieldMask found;
+      const bool stop_early = !mask.none(){% for field in typedef.fields if field.is_repeated() %} && !mask.is_set(FieldNumber::{{field.get_variable_id_name()}}){% endfor %};
+      bool done = false;
+
+      ::EmbeddedProto::Error tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+      while((::EmbeddedProto::Error::NO_ERRORS == return_value) && (::EmbeddedProto::Error::NO_ERRORS == tag_value) && !done)
+      {
+        id_tag = static_cast<FieldNumber>(id_number);
+        if(FieldNumber::NOT_SET == id_tag)
+        {
+          return_value = ::EmbeddedProto::Error::INVALID_FIELD_ID;
+        }
+        else if(!mask.is_set(id_tag))
+        {
+          // Unknown fields and fields which are not selected are skipped.
+          return_value = skip_unknown_field(buffer, wire_type);
+        }
+        else
+        {
+          switch(id_tag)
+          {
+            {% for field in typedef.fields %}
+            case FieldNumber::{{field.get_variable_id_name()}}:
+              {{ field.render_deserialize_masked(environment)|indent(14) }}
+              break;
+
+            {% endfor %}
+            {% for oneof in typedef.oneofs %}
+            {% for field in oneof.get_fields() %}
+            case FieldNumber::{{field.get_variable_id_name()}}:
+            {% endfor %}
+              return_value = deserialize_{{oneof.get_name()}}(id_tag, buffer, wire_type, mask);
+              // Only one field of the oneof can be set so consider them all found.
+              {% for field in oneof.get_fields() %}
+              found.set(FieldNumber::{{field.get_variable_id_name()}});
+              {% endfor %}
+              break;
+
+            {% endfor %}
+            default:
+              break;
+          }
+          found.set(id_tag);
+          done = stop_early && found.contains(mask);
+        }
+
+        if((::EmbeddedProto::Error::NO_ERRORS == return_value) && !done)
+        {
+          // Read the next tag.
+          tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+        }
+      }
+
+      // When an error was detect while reading the tag but no other errors where found, set it in the return value.
+      if((::EmbeddedProto::Error::NO_ERRORS == return_value)
+         && (::EmbeddedProto::Error::NO_ERRORS != tag_value)
+         && (::EmbeddedProto::Error::END_OF_BUFFER != tag_value)) // The end of the buffer is not an array in this case.
+      {
+        return_value = tag_value;
+      }
+
+      return return_value;
+    }
+
+    // Check if the data holds a valid serialized {{typedef.get_name()}} without deserializing it. The tags, wire types,
+    // varints, the bounds of length delimited fields and the nesting depth are checked, as well as the maximum length of
+    // strings, bytes and repeated fields. No field storage is used so invalid data can be rejected before a message is
+    // cleared to deserialize it.
+    static ::EmbeddedProto::Error validate(const uint8_t* data, const uint32_t size)
+    {
+      ::EmbeddedProto::ReadBufferView buffer(data, size);
+      return validate(buffer, 0);
+    }
+
+    // Validate the fields in the buffer, the depth is the number of messages this message is nested in.
+    template<class BUFFER_TYPE>
+    static ::EmbeddedProto::Error validate(BUFFER_TYPE& buffer, [[maybe_unused]] const uint32_t depth)
+    {
+      ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+      ::EmbeddedProto::WireFormatter::WireType wire_type = ::EmbeddedProto::WireFormatter::WireType::VARINT;
+      uint32_t id_number = 0;
+      FieldNumber id_tag = FieldNumber::NOT_SET;
+      {% for field in typedef.fields if field.is_repeated() %}
+      uint32_t n_{{field.get_name()}} = 0;
+      {% endfor %}
+
+      ::EmbeddedProto::Error tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+      while((::EmbeddedProto::Error::NO_ERRORS == return_value) && (::EmbeddedProto::Error::NO_ERRORS == tag_value))
+      {
+        id_tag = static_cast<FieldNumber>(id_number);
+        switch(id_tag)
+        {
+          {% for field in typedef.fields %}
+          case FieldNumber::{{field.get_variable_id_name()}}:
+            {% if "FieldErrorRecursive" == field.descriptor.type_name %}
+            return_value = skip_unknown_field(buffer, wire_type);
+            {% elif field.is_repeated() %}
+            return_value = {{field.get_type()}}::validate_check_type(buffer, wire_type, depth, n_{{field.get_name()}});
+            {% else %}
+            return_value = {{field.get_type()}}::validate_check_type(buffer, wire_type, depth);
+            {% endif %}
+            break;
+
+          {% endfor %}
+          {% for oneof in typedef.oneofs %}
+          {% for field in oneof.get_fields() %}
+          case FieldNumber::{{field.get_variable_id_name()}}:
+            {% if "FieldErrorRecursive" == field.descriptor.type_name %}
+            return_value = skip_unknown_field(buffer, wire_type);
+            {% elif field.is_repeated() %}
+            return_value = {{field.get_type()}}::validate_check_type(buffer, wire_type, depth, n_{{field.get_name()}});
+            {% else %}
+            return_value = {{field.get_type()}}::validate_check_type(buffer, wire_type, depth);
+            {% endif %}
+            break;
+
+          {% endfor %}
+          {% endfor %}
+          case FieldNumber::NOT_SET:
+            return_value = ::EmbeddedProto::Error::INVALID_FIELD_ID;
+            break;
+
+          default:
+            return_value = skip_unknown_field(buffer, wire_type);
+            break;
+        }
+
+        if(::EmbeddedProto::Error::NO_ERRORS == return_value)
+        {
+          // Read the next tag.
+          tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+        }
+      }
+
+      // When an error was detect while reading the tag but no other errors where found, set it in the return value.
+      if((::EmbeddedProto::Error::NO_ERRORS == return_value)
+         && (::EmbeddedProto::Error::NO_ERRORS != tag_value)
+         && (::EmbeddedProto::Error::END_OF_BUFFER != tag_value)) // The end of the buffer is not an array in this case.
+      {
+        return_value = tag_value;
+      }
+
+      return return_value;
+    }
+
+    // Validate this message when it is nested in an other message, the buffer starts at the length of the message.
+    template<class BUFFER_TYPE>
+    static ::EmbeddedProto::Error validate_check_type(BUFFER_TYPE& buffer,
+                                                      const ::EmbeddedProto::WireFormatter::WireType& wire_type,
+                                                      const uint32_t depth)
+    {
+      ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+      uint32_t size = 0;
+      if(::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED != wire_type)
+      {
+        return_value = ::EmbeddedProto::Error::INVALID_WIRETYPE;
+      }
+      else if(MAX_VALIDATE_DEPTH <= depth)
+      {
+        return_value = ::EmbeddedProto::Error::NESTING_TOO_DEEP;
+      }
+      else
+      {
+        return_value = ::EmbeddedProto::WireFormatter::DeserializeVarint(buffer, size);
+      }
+
+      if(::EmbeddedProto::Error::NO_ERRORS == return_value)
+      {
+        ::EmbeddedProto::ReadBufferSection section(buffer, size);
+        if(section.get_max_size() < size)
+        {
+          // The message is longer than the data left.
+          return_value = ::EmbeddedProto::Error::END_OF_BUFFER;
+        }
+        else
+        {
+          return_value = validate(section, depth + 1);
+          if((::EmbeddedProto::Error::NO_ERRORS == return_value) && (0 < section.get_size()))
+          {
+            return_value = ::EmbeddedProto::Error::END_OF_BUFFER;
+          }
+        }
+      }
+      return return_value;
+    }
+
     void clear() override
     {
       {% for field in typedef.fields %}
@@ -324,7 +833,9 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
       }
 
       {% for field in typedef.fields %}
-      {%if "FieldErrorRecursive" != field.descriptor.type_name %}{# Test if this is an FieldErrorRecursive #}
+      {% if field.bit_packed %}
+      left_chars = ::EmbeddedProto::boolean(get_{{field.get_name()}}()).to_string(left_chars, indent_level + 2, {{field.get_name()|upper}}_NAME, {{ loop.first|lower }});
+      {% elif "FieldErrorRecursive" != field.descriptor.type_name %}{# Test if this is an FieldErrorRecursive #}
       left_chars = {{field.get_variable_name()}}.to_string(left_chars, indent_level + 2, {{field.get_name()|upper}}_NAME, {{ loop.first|lower }});
       {% endif %}
       {% endfor %}
@@ -353,24 +864,25 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
 
   private:
 
-      {% if typedef.optional_fields is defined and typedef.optional_fields|length > 0 %}
+      {% if typedef.bit_flags|length > 0 %}
       // Define constants for tracking the presence of fields.
       // Use a struct to scope the variables from user fields as namespaces are not allowed within classes.
       struct presence
       {
-        // An enumeration with all the fields for which presence has to be tracked.
+        // An enumeration with all the fields for which presence has to be tracked. In a compact layout the values of
+        // boolean fields are stored here as well.
         enum class fields : uint32_t
         {
-          {% for field in typedef.optional_fields %}
-          {{field.get_name().upper()}}{{ "," if not loop.last }}
+          {% for bit_flag in typedef.bit_flags %}
+          {{bit_flag}}{{ "," if not loop.last }}
           {% endfor %}
         };
 
         // The number of fields for which presence has to be tracked.
-        static constexpr uint32_t N_FIELDS = {{typedef.optional_fields|length}};
+        static constexpr uint32_t N_FIELDS = {{typedef.bit_flags|length}};
 
         // Which type are we using to track presence.
-        using TYPE = uint32_t;
+        using TYPE = {{typedef.get_bit_flags_type()}};
 
         // How many bits are there in the presence type.
         static constexpr uint32_t N_BITS = std::numeric_limits<TYPE>::digits;
@@ -384,41 +896,51 @@ class {{ typedef.get_name() }} final: public ::EmbeddedProto::MessageInterface
         // Obtain the bit mask for the given field assuming we are at the correct index in the presence array.
         static constexpr TYPE mask(const fields& field)
         {
-          return static_cast<uint32_t>(0x01) << (static_cast<uint32_t>(field) % N_BITS);
+          return static_cast<TYPE>(static_cast<uint32_t>(0x01) << (static_cast<uint32_t>(field) % N_BITS));
         }
       };
 
+      {% endif %}
+      {% if typedef.track_changes %}
+      // The fields changed since the last call to mark_clean().
+      FieldMask changed_;
+
+      {% endif %}
+      {% for kind, member in typedef.get_member_variables() %}
+      {% if "presence" == kind %}
       // Create an array in which the presence flags are stored.
       typename presence::TYPE presence_[presence::SIZE] = {0};
-      {% endif %}
 
-      {% for field in typedef.fields %}
-      {% if field.get_default_value() %}
-      {{field.get_type()}} {{field.get_variable_name()}} = {{field.get_default_value()}};
+      {% elif "field" == kind %}
+      {% if member.get_default_value() %}
+      {{member.get_member_type()}} {{member.get_variable_name()}} = {{member.get_default_value()}};
       {% else %}
-      {{field.get_type()}} {{field.get_variable_name()}};
+      {{member.get_member_type()}} {{member.get_variable_name()}};
       {% endif %}
-      {% endfor %}
+      {% if loop.last or "field" != loop.nextitem[0] %}
 
-      {% for oneof in typedef.oneofs %}
-      FieldNumber {{oneof.get_which_oneof()}} = FieldNumber::NOT_SET;
-      union {{oneof.get_name()}}
+      {% endif %}
+      {% else %}
+      FieldNumber {{member.get_which_oneof()}} = FieldNumber::NOT_SET;
+      union {{member.get_name()}}
       {
-        {{oneof.get_name()}}() {}
-        ~{{oneof.get_name()}}() {}
-        {% for field in oneof.fields %}
+        {{member.get_name()}}() {}
+        ~{{member.get_name()}}() {}
+        {% for field in member.fields %}
         {# Here we use the field name variable instead of the get_ function as the get function will add the oneof
            name. This is the only place where this is required. #}
         {{field.get_type()}} {{field.variable_name}};
         {% endfor %}
       };
-      {{oneof.get_name()}} {{oneof.get_variable_name()}};
+      {{member.get_name()}} {{member.get_variable_name()}};
 
-      {{ TypeOneof.init(oneof)|indent(6) }}
-      {{ TypeOneof.clear(oneof)|indent(6) }}
-      {{ TypeOneof.deserialize(oneof, environment)|indent(6) }}
+      {{ TypeOneof.init(member)|indent(6) }}
+      {{ TypeOneof.clear(member)|indent(6) }}
+      {{ TypeOneof.deserialize(member, environment)|indent(6) }}
+      {{ TypeOneof.deserialize_masked(member, environment)|indent(6) }}
 #ifdef MSG_TO_STRING 
-      {{ TypeOneof.to_string(oneof)|indent(6) }}
+      {{ TypeOneof.to_string(member)|indent(6) }}
 #endif // End of MSG_TO_STRING
+      {% endif %}
       {% endfor %}
 };
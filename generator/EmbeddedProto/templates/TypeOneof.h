@@ -27,7 +27,7 @@ Postal address:
   1627 LE, Hoorn
   the Netherlands
 #}
-{% macro assign(_oneof) %}
+{% macro assign(_oneof, _move=false) %}
 if(rhs.get_which_{{_oneof.get_name()}}() != {{_oneof.get_which_oneof()}})
 {
   // First delete the old object in the oneof.
@@ -38,7 +38,11 @@ switch(rhs.get_which_{{_oneof.get_name()}}())
 {
   {% for field in _oneof.get_fields() %}
   case FieldNumber::{{field.get_variable_id_name()}}:
+    {% if _move and field.is_movable() %}
+    set_{{field.get_name()}}(std::move(rhs.mutable_{{field.name}}()));
+    {% else %}
     set_{{field.get_name()}}(rhs.get_{{field.name}}());
+    {% endif %}
     break;
 
   {% endfor %}
@@ -107,8 +111,9 @@ void clear_{{_oneof.get_name()}}()
 {# ------------------------------------------------------------------------------------------------------------------ #}
 {# #}
 {% macro deserialize(_oneof, _environment) %}
+template<class BUFFER_TYPE>
 ::EmbeddedProto::Error deserialize_{{_oneof.get_name()}}(const FieldNumber field_id, 
-                              ::EmbeddedProto::ReadBufferInterface& buffer,
+                              BUFFER_TYPE& buffer,
                               const ::EmbeddedProto::WireFormatter::WireType wire_type)
 {
   ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
@@ -139,6 +144,45 @@ void clear_{{_oneof.get_name()}}()
 {# #}
 {# ------------------------------------------------------------------------------------------------------------------ #}
 {# #}
+{% macro deserialize_masked(_oneof, _environment) %}
+{% set ns = namespace(has_mask=false) %}
+{% for field in _oneof.get_fields() if field.has_field_mask() %}
+{% set ns.has_mask = true %}
+{% endfor %}
+template<class BUFFER_TYPE>
+::EmbeddedProto::Error deserialize_{{_oneof.get_name()}}(const FieldNumber field_id, 
+                              BUFFER_TYPE& buffer,
+                              const ::EmbeddedProto::WireFormatter::WireType wire_type,
+                              const FieldMask&{% if ns.has_mask %} mask{% endif %})
+{
+  ::EmbeddedProto::Error return_value = ::EmbeddedProto::Error::NO_ERRORS;
+  
+  if(field_id != {{_oneof.get_which_oneof()}})
+  {
+    init_{{_oneof.get_name()}}(field_id);
+  }
+
+  switch({{_oneof.get_which_oneof()}})
+  {
+    {% for field in _oneof.get_fields() %}
+    case FieldNumber::{{field.get_variable_id_name()}}:
+      {{ field.render_deserialize_masked(_environment)|indent(6) }}
+      break;
+    {% endfor %}
+    default:
+      break;
+  }
+
+  if(::EmbeddedProto::Error::NO_ERRORS != return_value)
+  {
+    clear_{{_oneof.get_name()}}();
+  }
+  return return_value;
+}
+{% endmacro %}
+{# #}
+{# ------------------------------------------------------------------------------------------------------------------ #}
+{# #}
 {% macro to_string(_oneof) %}
 ::EmbeddedProto::string_view to_string_{{_oneof.get_name()}}(::EmbeddedProto::string_view& str, const uint32_t indent_level, const bool first_field) const
 {
@@ -0,0 +1,210 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _CACHED_SERIALIZER_H_
+#define _CACHED_SERIALIZER_H_
+
+#include "Errors.h"
+#include "WriteBufferInterface.h"
+#include "WriteBufferFixedSize.h"
+
+#include <cstdint>
+#include <utility>
+
+
+namespace EmbeddedProto
+{
+
+  //! Keep the serialized bytes of a message which is send often without being changed.
+  /*!
+    The message is serialized into an internal buffer the first time serialize() is called. Later 
+    calls copy these bytes into the output buffer as long as the message has not been changed. 
+
+    Change the message through modify(), which returns a Mutator. The stored bytes are dropped when 
+    the mutator is created and again when it is destroyed, and nothing is stored while a mutator 
+    exists. Changes made through the mutator, including those to nested messages and repeated 
+    fields, are therefore always serialized. set() replaces the whole message.
+
+    mutable_message() only drops the stored bytes when it is called. Do not keep the returned 
+    reference: changes made through it after the next call to serialize() are not picked up unless 
+    invalidate() is called.
+
+    When the serialized message does not fit in CAPACITY bytes it is serialized directly every time 
+    until the message is changed.
+  */
+  template<class MESSAGE_TYPE, uint32_t CAPACITY = MESSAGE_TYPE::MAX_SERIALIZED_SIZE>
+  class CachedSerializer
+  {
+    public:
+
+      //! Scoped access to change the message of a CachedSerializer.
+      class Mutator
+      {
+        public:
+
+          explicit Mutator(CachedSerializer<MESSAGE_TYPE, CAPACITY>& owner) :
+            owner_(&owner)
+          {
+            owner_->invalidate();
+            ++(owner_->n_mutators_);
+          }
+
+          Mutator(Mutator&& rhs) noexcept :
+            owner_(rhs.owner_)
+          {
+            rhs.owner_ = nullptr;
+          }
+
+          Mutator(const Mutator& rhs) = delete;
+          Mutator& operator=(const Mutator& rhs) = delete;
+          Mutator& operator=(Mutator&& rhs) = delete;
+
+          ~Mutator()
+          {
+            if(nullptr != owner_)
+            {
+              --(owner_->n_mutators_);
+              owner_->invalidate();
+            }
+          }
+
+          MESSAGE_TYPE& operator*() const { return owner_->message_; }
+          MESSAGE_TYPE* operator->() const { return &(owner_->message_); }
+
+        private:
+
+          CachedSerializer<MESSAGE_TYPE, CAPACITY>* owner_;
+      };
+
+      CachedSerializer() = default;
+      ~CachedSerializer() = default;
+
+      explicit CachedSerializer(const MESSAGE_TYPE& message) :
+        message_(message)
+      {
+
+      }
+
+      //! Read only access to the message, the stored bytes remain valid.
+      const MESSAGE_TYPE& get() const { return message_; }
+
+      //! Obtain scoped access to change the message, see Mutator.
+      Mutator modify() { return Mutator(*this); }
+
+      //! Access the message to change it, the stored bytes are dropped.
+      /*!
+        Only changes made before the next call to serialize() are included, prefer modify().
+      */
+      MESSAGE_TYPE& mutable_message()
+      {
+        invalidate();
+        return message_;
+      }
+
+      //! Replace the message, the stored bytes are dropped.
+      void set(const MESSAGE_TYPE& message)
+      {
+        message_ = message;
+        invalidate();
+      }
+
+      //! Replace the message, the stored bytes are dropped.
+      void set(MESSAGE_TYPE&& message)
+      {
+        message_ = std::move(message);
+        invalidate();
+      }
+
+      //! Drop the stored bytes, the next call to serialize() will serialize the message again.
+      void invalidate() 
+      { 
+        valid_ = false;
+        too_large_ = false;
+      }
+
+      //! Returns true when the serialized bytes of the current message are stored.
+      bool is_cached() const { return valid_; }
+
+      //! Serialize the message, from the stored bytes when available.
+      Error serialize(WriteBufferInterface& buffer) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        if(!valid_ && !too_large_ && (0 == n_mutators_))
+        {
+          cache_.clear();
+          return_value = message_.serialize(cache_);
+          valid_ = (Error::NO_ERRORS == return_value);
+          // Remember the message does not fit so it is not tried again until it changes.
+          too_large_ = (Error::BUFFER_FULL == return_value);
+        }
+
+        if(valid_)
+        {
+          if(!buffer.push(cache_.get_data(), cache_.get_size()))
+          {
+            return_value = Error::BUFFER_FULL;
+          }
+        }
+        else if((Error::NO_ERRORS == return_value) || (Error::BUFFER_FULL == return_value))
+        {
+          // The message does not fit in the cache or is being changed.
+          return_value = message_.serialize(buffer);
+        }
+
+        return return_value;
+      }
+
+      //! The number of bytes serialize() will write.
+      uint32_t serialized_size() const
+      {
+        return valid_ ? cache_.get_size() : message_.serialized_size();
+      }
+
+    private:
+
+      //! The message itself.
+      MESSAGE_TYPE message_;
+
+      //! The serialized bytes of the message.
+      mutable WriteBufferFixedSize<CAPACITY> cache_;
+
+      //! True when cache_ holds the serialized bytes of message_.
+      mutable bool valid_ = false;
+
+      //! True when message_ did not fit in cache_.
+      mutable bool too_large_ = false;
+
+      //! The number of Mutator objects which currently give access to message_.
+      uint32_t n_mutators_ = 0;
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _CACHED_SERIALIZER_H_
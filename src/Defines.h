@@ -73,11 +73,25 @@ namespace EmbeddedProto
 #endif
 
 
+  //! Obtain the largest of two values at compile time.
+  /*!
+    std::max is only constexpr from C++14 onwards.
+  */
+  template<class T>
+  constexpr T constexpr_max(const T a, const T b)
+  {
+    return (a > b) ? a : b;
+  }
+
   //! An simple struct holding both a pointer to an array and the size of that array.
   template<class T>
   struct array_view {
     T* data; //!< A pointer to the start of an array.
     uint32_t size; //!< The number of elements in the array.
+
+    //! Iterators to use the view in range based for loops and standard algorithms.
+    T* begin() const { return data; }
+    T* end() const { return data + size; }
   };
 
   using string_view = array_view<char>;
@@ -45,6 +45,8 @@ namespace EmbeddedProto
     INVALID_FIELD_ID = 5, //!< When the id obtained from the tag equeals zero.
     OVERLONG_VARINT  = 6, //!< The maximum number of bytes where read for this varint but we did not reach the end of the data.
     INDEX_OUT_OF_BOUND = 7, //!< You are trying to access an index outside of valid data.
+    INVALID_UTF8     = 8, //!< A string field does not hold valid UTF-8, only checked when MSG_VALIDATE_UTF8 is defined.
+    NESTING_TOO_DEEP = 9, //!< Validated data has more nested messages than MessageInterface::MAX_VALIDATE_DEPTH.
   };
 
 }; // End of namespace EmbeddedProto
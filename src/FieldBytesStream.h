@@ -0,0 +1,345 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _FIELD_BYTES_STREAM_H_
+#define _FIELD_BYTES_STREAM_H_
+
+#include "Fields.h"
+#include "FieldStringBytes.h"
+#include "Hash.h"
+#include "WireFormatter.h"
+#include "ReadBufferInterface.h"
+#include "WriteBufferInterface.h"
+#include "Errors.h"
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+
+namespace EmbeddedProto
+{
+
+  //! Implement this interface to provide the data of a streamed bytes or string field when serializing.
+  class BytesSource
+  {
+    public:
+      BytesSource() = default;
+      virtual ~BytesSource() = default;
+
+      //! The total number of bytes to serialize.
+      virtual uint32_t get_size() const = 0;
+
+      //! Copy a part of the data.
+      /*!
+        The data is requested in order, one chunk at the time.
+        \param[in] offset The index of the first byte requested.
+        \param[out] data The memory to copy the bytes to.
+        \param[in] n_bytes The number of bytes to copy.
+        \return Any error other than NO_ERRORS stops the serialization and is returned.
+      */
+      virtual Error read(const uint32_t offset, uint8_t* data, const uint32_t n_bytes) const = 0;
+  };
+
+  //! Implement this interface to receive the data of a streamed bytes or string field when deserializing.
+  class BytesSink
+  {
+    public:
+      BytesSink() = default;
+      virtual ~BytesSink() = default;
+
+      //! Called when the field is found, before any data.
+      /*!
+        \param[in] size The total number of bytes which will follow.
+        \return Any error other than NO_ERRORS stops the deserialization and is returned.
+      */
+      virtual Error begin(const uint32_t size) = 0;
+
+      //! Called for each chunk of data, in order.
+      /*!
+        \param[in] data The bytes received, only valid during the call.
+        \param[in] n_bytes The number of bytes received.
+        \return Any error other than NO_ERRORS stops the deserialization and is returned.
+      */
+      virtual Error write(const uint8_t* data, const uint32_t n_bytes) = 0;
+  };
+
+  //! A bytes or string field of which the data is not stored in the message.
+  /*!
+    When serializing, the data is read in chunks from a BytesSource. When deserializing, the data is 
+    passed on in chunks to a BytesSink as it is read from the buffer. At most CHUNK_SIZE bytes are 
+    kept on the stack. When the buffer holds all data in memory, like ReadBufferView, the sink 
+    receives all data in a single call without copying it.
+
+    MAX_LENGTH is the largest number of bytes accepted. It is used to calculate the maximum 
+    serialized size of the message and does not affect the memory used. Strings are not checked 
+    for valid UTF-8.
+
+    Without a source nothing is serialized, without a sink the data received is skipped.
+  */
+  template<uint32_t MAX_LENGTH, uint32_t CHUNK_SIZE = 32>
+  class FieldBytesStream
+  {
+      static_assert(0 < CHUNK_SIZE, "The chunk size should at least be one byte.");
+
+    public:
+
+      FieldBytesStream() = default;
+      ~FieldBytesStream() = default;
+
+      //! The maximum number of bytes the data takes when serialized, excluding the tag and length.
+      static constexpr uint32_t MAX_SERIALIZED_SIZE = MAX_LENGTH;
+
+      //! The maximum number of bytes this field takes when serialized with the given field number.
+      static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number)
+      {
+        return WireFormatter::LengthDelimitedSize(field_number, MAX_SERIALIZED_SIZE);
+      }
+
+      //! Set the source of the data to serialize, the source should outlive the serialization.
+      void set_source(const BytesSource* source) { source_ = source; }
+      const BytesSource* get_source() const { return source_; }
+
+      //! Set the sink receiving the data when deserializing.
+      void set_sink(BytesSink* sink) { sink_ = sink; }
+      BytesSink* get_sink() const { return sink_; }
+
+      //! The number of bytes provided by the source.
+      uint32_t get_size() const { return (nullptr != source_) ? source_->get_size() : 0; }
+
+      //! The maximum number of bytes accepted.
+      static constexpr uint32_t get_max_length() { return MAX_LENGTH; }
+
+      //! There is no data to clear, the source and sink are kept.
+      void clear() { }
+
+      //! Serialize the data of the source in chunks.
+      /*!
+        \return ARRAY_FULL when the source holds more than MAX_LENGTH bytes, the first error 
+                returned by the source or the result of writing to the buffer.
+      */
+      Error serialize_with_id(uint32_t field_number, WriteBufferInterface& buffer, const bool optional) const
+      {
+        const uint32_t size = get_size();
+        Error return_value = (MAX_LENGTH >= size) ? Error::NO_ERRORS : Error::ARRAY_FULL;
+        if((Error::NO_ERRORS == return_value) && ((0 < size) || optional))
+        {
+          return_value = WireFormatter::SerializeVarint(
+                            WireFormatter::MakeTag(field_number, WireFormatter::WireType::LENGTH_DELIMITED), buffer);
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::SerializeVarint(size, buffer);
+          }
+          if((Error::NO_ERRORS == return_value) && (size > buffer.get_available_size()))
+          {
+            return_value = Error::BUFFER_FULL;
+          }
+
+          uint8_t chunk[CHUNK_SIZE];
+          for(uint32_t offset = 0; (offset < size) && (Error::NO_ERRORS == return_value); offset += CHUNK_SIZE)
+          {
+            const uint32_t n_bytes = std::min(CHUNK_SIZE, size - offset);
+            return_value = source_->read(offset, chunk, n_bytes);
+            if((Error::NO_ERRORS == return_value) && !buffer.push(chunk, n_bytes))
+            {
+              return_value = Error::BUFFER_FULL;
+            }
+          }
+        }
+        return return_value;
+      }
+
+      //! Read the data from the buffer and pass it on to the sink in chunks.
+      Error deserialize_check_type(ReadBufferInterface& buffer, const WireFormatter::WireType& wire_type)
+      {
+        Error return_value = WireFormatter::WireType::LENGTH_DELIMITED == wire_type 
+                             ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
+        uint32_t size = 0;
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = WireFormatter::DeserializeVarint(buffer, size);
+        }
+        if((Error::NO_ERRORS == return_value) && (MAX_LENGTH < size))
+        {
+          return_value = Error::ARRAY_FULL;
+        }
+
+        if(Error::NO_ERRORS == return_value)
+        {
+          if(nullptr == sink_)
+          {
+            return_value = buffer.advance(size) ? Error::NO_ERRORS : Error::END_OF_BUFFER;
+          }
+          else
+          {
+            return_value = sink_->begin(size);
+            if(Error::NO_ERRORS == return_value)
+            {
+              return_value = receive(buffer, size);
+            }
+          }
+        }
+        return return_value;
+      }
+
+      //! \see internal::FieldStringBytes::validate_check_type()
+      template<class BUFFER_TYPE>
+      static Error validate_check_type(BUFFER_TYPE& buffer, const WireFormatter::WireType& wire_type,
+                                       const uint32_t depth)
+      {
+        return FieldBytes<MAX_LENGTH>::validate_check_type(buffer, wire_type, depth);
+      }
+
+      //! Compare the data of both sources, the sinks are not compared.
+      bool operator==(const FieldBytesStream<MAX_LENGTH, CHUNK_SIZE>& rhs) const
+      {
+        const uint32_t size = get_size();
+        bool equal = (size == rhs.get_size());
+        uint8_t lhs_chunk[CHUNK_SIZE];
+        uint8_t rhs_chunk[CHUNK_SIZE];
+        for(uint32_t offset = 0; equal && (offset < size); offset += CHUNK_SIZE)
+        {
+          const uint32_t n_bytes = std::min(CHUNK_SIZE, size - offset);
+          equal = (Error::NO_ERRORS == source_->read(offset, lhs_chunk, n_bytes))
+                  && (Error::NO_ERRORS == rhs.source_->read(offset, rhs_chunk, n_bytes))
+                  && (0 == memcmp(lhs_chunk, rhs_chunk, n_bytes));
+        }
+        return equal;
+      }
+
+      bool operator!=(const FieldBytesStream<MAX_LENGTH, CHUNK_SIZE>& rhs) const { return !(*this == rhs); }
+
+      //! Mix the size and the data of the source into the given hash.
+      uint64_t hash(const uint64_t seed) const
+      {
+        const uint32_t size = get_size();
+        uint64_t result = Hash::value(seed, size);
+        uint8_t chunk[CHUNK_SIZE];
+        bool ok = true;
+        for(uint32_t offset = 0; ok && (offset < size); offset += CHUNK_SIZE)
+        {
+          const uint32_t n_bytes = std::min(CHUNK_SIZE, size - offset);
+          ok = (Error::NO_ERRORS == source_->read(offset, chunk, n_bytes));
+          if(ok)
+          {
+            result = Hash::bytes(result, chunk, n_bytes);
+          }
+        }
+        return result;
+      }
+
+#ifdef MSG_TO_STRING
+
+      //! Only the size is printed, the data is not available in the message.
+      ::EmbeddedProto::string_view to_string(::EmbeddedProto::string_view& str, const uint32_t indent_level, char const* name, const bool first_field) const
+      {
+        ::EmbeddedProto::string_view left_chars = str;
+        int32_t n_chars_used = 0;
+
+        if(!first_field)
+        {
+          // Add a comma behind the previous field.
+          n_chars_used = snprintf(left_chars.data, left_chars.size, ",\n");
+          if(0 < n_chars_used)
+          {
+            // Update the character pointer and characters left in the array.
+            left_chars.data += n_chars_used;
+            left_chars.size -= n_chars_used;
+          }
+        }
+
+        n_chars_used = snprintf(left_chars.data, left_chars.size, "%*s\"%s\": \"<%u bytes>\"", indent_level, " ", 
+                                name, static_cast<unsigned int>(get_size()));
+
+        if(0 < n_chars_used)
+        {
+          left_chars.data += n_chars_used;
+          left_chars.size -= n_chars_used;
+        }
+
+        return left_chars;
+      }
+
+#endif // End of MSG_TO_STRING
+
+    private:
+
+      //! Pass size bytes from the buffer on to the sink.
+      Error receive(ReadBufferInterface& buffer, const uint32_t size)
+      {
+        Error return_value = Error::NO_ERRORS;
+        const uint8_t* data = buffer.get_persistent_data(size);
+        if(nullptr != data)
+        {
+          // All data is already in memory, no need to copy it.
+          if(0 < size)
+          {
+            return_value = sink_->write(data, size);
+          }
+          buffer.advance(size);
+        }
+        else
+        {
+          uint8_t chunk[CHUNK_SIZE];
+          uint32_t left = size;
+          while((0 < left) && (Error::NO_ERRORS == return_value))
+          {
+            const uint32_t n_bytes = std::min(CHUNK_SIZE, left);
+            uint32_t n_read = 0;
+            while((n_read < n_bytes) && buffer.pop(chunk[n_read]))
+            {
+              ++n_read;
+            }
+
+            if(n_read != n_bytes)
+            {
+              // We ran out of data before the end of the field.
+              return_value = Error::END_OF_BUFFER;
+            }
+            else
+            {
+              return_value = sink_->write(chunk, n_bytes);
+              left -= n_bytes;
+            }
+          }
+        }
+        return return_value;
+      }
+
+      //! The data to serialize.
+      const BytesSource* source_ = nullptr;
+
+      //! The receiver of deserialized data.
+      BytesSink* sink_ = nullptr;
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _FIELD_BYTES_STREAM_H_
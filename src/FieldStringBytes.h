@@ -33,6 +33,8 @@
 
 #include "Defines.h"
 #include "Fields.h"
+#include "Hash.h"
+#include "Utf8.h"
 #include "Errors.h"
 
 #include <cstdint>
@@ -58,8 +60,43 @@ namespace EmbeddedProto
       public:
 
         FieldStringBytes() = default;
+
+        //! Only copy the characters in use, the rest of the array is left zero.
+        FieldStringBytes(const FieldStringBytes<MAX_LENGTH, DATA_TYPE>& rhs) :
+          BaseStringBytes(),
+          current_length_(rhs.current_length_)
+        {
+          memcpy(data_.data(), rhs.data_.data(), current_length_);
+        }
+
+        //! The data is stored in a fixed size array, moving is copying the characters in use.
+        FieldStringBytes(FieldStringBytes<MAX_LENGTH, DATA_TYPE>&& rhs) noexcept :
+          FieldStringBytes(static_cast<const FieldStringBytes<MAX_LENGTH, DATA_TYPE>&>(rhs))
+        {
+          // Use the copy constructor.
+        }
         
         ~FieldStringBytes() override = default;
+
+        //! Only copy the characters in use and clear the ones left over from a longer value.
+        FieldStringBytes<MAX_LENGTH, DATA_TYPE>& operator=(const FieldStringBytes<MAX_LENGTH, DATA_TYPE>& rhs)
+        {
+          if(this != &rhs)
+          {
+            if(current_length_ > rhs.current_length_)
+            {
+              memset(data_.data() + rhs.current_length_, 0, current_length_ - rhs.current_length_);
+            }
+            current_length_ = rhs.current_length_;
+            memcpy(data_.data(), rhs.data_.data(), current_length_);
+          }
+          return *this;
+        }
+
+        FieldStringBytes<MAX_LENGTH, DATA_TYPE>& operator=(FieldStringBytes<MAX_LENGTH, DATA_TYPE>&& rhs) noexcept
+        {
+          return this->operator=(static_cast<const FieldStringBytes<MAX_LENGTH, DATA_TYPE>&>(rhs));
+        }
         
         //! Obtain the number of characters in the string right now.
         uint32_t get_length() const { return current_length_; }
@@ -70,6 +107,23 @@ namespace EmbeddedProto
         //! Get a constant pointer to the first element in the array.
         const DATA_TYPE* get_const() const { return data_.data(); }
 
+        //! Two strings or byte arrays are equal when the characters or bytes in use are the same.
+        template<uint32_t RHS_LENGTH>
+        bool operator==(const FieldStringBytes<RHS_LENGTH, DATA_TYPE>& rhs) const
+        {
+          return (current_length_ == rhs.get_length()) && 
+                 (0 == memcmp(data_.data(), rhs.get_const(), current_length_));
+        }
+
+        template<uint32_t RHS_LENGTH>
+        bool operator!=(const FieldStringBytes<RHS_LENGTH, DATA_TYPE>& rhs) const { return !(*this == rhs); }
+
+        //! Mix the characters or bytes in use into the given hash.
+        uint64_t hash(const uint64_t seed) const 
+        { 
+          return Hash::bytes(seed, reinterpret_cast<const uint8_t*>(data_.data()), current_length_);
+        }
+
         //! Get a reference to the value at the given index. 
         /*!
           This function will update the number of elements used in the array/string.
@@ -203,6 +257,15 @@ namespace EmbeddedProto
           return return_value;
         }
 
+        //! The maximum number of bytes the data takes when serialized, excluding the tag and length.
+        static constexpr uint32_t MAX_SERIALIZED_SIZE = MAX_LENGTH;
+
+        //! The maximum number of bytes this field takes when serialized with the given field number.
+        static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number)
+        {
+          return WireFormatter::LengthDelimitedSize(field_number, MAX_SERIALIZED_SIZE);
+        }
+
         Error serialize(WriteBufferInterface& buffer) const override 
         { 
           Error return_value = Error::NO_ERRORS;
@@ -237,6 +300,15 @@ namespace EmbeddedProto
                 // If at the end we did not read the same number of characters something went wrong.
                 return_value = Error::END_OF_BUFFER;
               }
+#ifdef MSG_VALIDATE_UTF8
+              else if(std::is_same<char, DATA_TYPE>::value && 
+                      !is_valid_utf8(reinterpret_cast<const uint8_t*>(data_.data()), current_length_))
+              {
+                // Strings should hold valid UTF-8, do not keep the invalid data.
+                clear();
+                return_value = Error::INVALID_UTF8;
+              }
+#endif // End of MSG_VALIDATE_UTF8
             }
             else 
             {
@@ -259,6 +331,37 @@ namespace EmbeddedProto
           return return_value;
         }
 
+        //! Check the serialized data of this field without storing it, see the generated validate().
+        /*!
+          Only the length is checked against MAX_LENGTH, the data itself is skipped. The depth is 
+          not used by strings and bytes.
+        */
+        template<class BUFFER_TYPE>
+        static Error validate_check_type(BUFFER_TYPE& buffer, 
+                                         const ::EmbeddedProto::WireFormatter::WireType& wire_type,
+                                         [[maybe_unused]] const uint32_t depth)
+        {
+          Error return_value = ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED == wire_type 
+                               ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
+          uint32_t size = 0;
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::DeserializeVarint(buffer, size);
+          }
+          if(Error::NO_ERRORS == return_value)
+          {
+            if(MAX_LENGTH < size)
+            {
+              return_value = Error::ARRAY_FULL;
+            }
+            else if(!buffer.advance(size))
+            {
+              return_value = Error::END_OF_BUFFER;
+            }
+          }
+          return return_value;
+        }
+
         //! Reset the field to it's initial value.
         void clear() override 
         { 
@@ -298,8 +401,13 @@ namespace EmbeddedProto
       using internal::FieldStringBytes<MAX_LENGTH, char>::set;
 
       FieldString() = default;
+      FieldString(const FieldString<MAX_LENGTH>& rhs) = default;
+      FieldString(FieldString<MAX_LENGTH>&& rhs) = default;
       ~FieldString() override = default;
 
+      FieldString<MAX_LENGTH>& operator=(const FieldString<MAX_LENGTH>& rhs) = default;
+      FieldString<MAX_LENGTH>& operator=(FieldString<MAX_LENGTH>&& rhs) = default;
+
       //! Assign the values in the right hand side FieldStringBytes object to this object.
       /*!
           This is only compatible with the same data type and length.
@@ -414,8 +522,13 @@ namespace EmbeddedProto
   {
     public:
       FieldBytes() = default;
+      FieldBytes(const FieldBytes<MAX_LENGTH>& rhs) = default;
+      FieldBytes(FieldBytes<MAX_LENGTH>&& rhs) = default;
       ~FieldBytes() override = default;
 
+      FieldBytes<MAX_LENGTH>& operator=(const FieldBytes<MAX_LENGTH>& rhs) = default;
+      FieldBytes<MAX_LENGTH>& operator=(FieldBytes<MAX_LENGTH>&& rhs) = default;
+
       //! Assign the values in the right hand side FieldStringBytes object to this object.
       /*!
           This is only compatible with the same data type and length.
@@ -34,11 +34,14 @@
 #include "Errors.h"
 #include "Defines.h"
 #include "WireFormatter.h"
+#include "Hash.h"
 #include "WriteBufferInterface.h"
 #include "ReadBufferInterface.h"
 #include "MessageSizeCalculator.h"
 
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #ifdef MSG_TO_STRING
 #include <cstdio>
@@ -126,14 +129,31 @@ namespace EmbeddedProto
       using TYPE = VARIABLE_TYPE;
       using CLASS_TYPE = FieldTemplate<FIELDTYPE, VARIABLE_TYPE, WIRETYPE>;
 
+      //! The wire type used to serialize this field.
+      static constexpr WireFormatter::WireType WIRE_TYPE = WIRETYPE;
+
+      //! The maximum number of bytes the value of this field takes when serialized, excluding the tag.
+      /*!
+        Signed 32 bit integers and enums are serialized as unsigned 32 bit varints.
+      */
+      static constexpr uint32_t MAX_SERIALIZED_SIZE = 
+          (WireFormatter::WireType::FIXED32 == WIRETYPE) ? sizeof(uint32_t) :
+          (WireFormatter::WireType::FIXED64 == WIRETYPE) ? sizeof(uint64_t) :
+          (Field::FieldTypes::boolean == FIELDTYPE) ? 1 :
+          (sizeof(uint32_t) >= sizeof(VARIABLE_TYPE)) ? WireFormatter::VarintSize(std::numeric_limits<uint32_t>::max()) 
+                                                      : WireFormatter::VarintSize(std::numeric_limits<uint64_t>::max());
+
       FieldTemplate() = default;
       FieldTemplate(const VARIABLE_TYPE& v) : value_(v) { };
       FieldTemplate(const VARIABLE_TYPE&& v) : value_(v) { };
-      FieldTemplate(const CLASS_TYPE& ft) : value_(ft.value_) { };
+      FieldTemplate(const CLASS_TYPE& ft) = default;
+      FieldTemplate(CLASS_TYPE&& ft) = default;
 
       ~FieldTemplate() = default;
 
-      Error serialize_with_id(uint32_t field_number, WriteBufferInterface& buffer, [[maybe_unused]] const bool optional) const
+      //! The functions taking a buffer are templated on the buffer type, see WireFormatter.
+      template<class BUFFER_TYPE>
+      Error serialize_with_id(uint32_t field_number, BUFFER_TYPE& buffer, [[maybe_unused]] const bool optional) const
       {
         Error return_value = WireFormatter::SerializeVarint(WireFormatter::MakeTag(field_number, WIRETYPE), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -143,18 +163,27 @@ namespace EmbeddedProto
         return return_value;
       }   
 
-      Error serialize(WriteBufferInterface& buffer) const
+      //! The maximum number of bytes this field takes when serialized with the tag of the given field number.
+      static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number)
+      {
+        return WireFormatter::TagSize(field_number) + MAX_SERIALIZED_SIZE;
+      }
+
+      template<class BUFFER_TYPE>
+      Error serialize(BUFFER_TYPE& buffer) const
       {
         return serialize_<FIELDTYPE>(buffer);
       }
 
-      Error deserialize(ReadBufferInterface& buffer)
+      template<class BUFFER_TYPE>
+      Error deserialize(BUFFER_TYPE& buffer)
       {
         return deserialize_<FIELDTYPE>(buffer);
       }
 
       //! \see Field::deserialize()
-      Error deserialize_check_type(ReadBufferInterface& buffer, 
+      template<class BUFFER_TYPE>
+      Error deserialize_check_type(BUFFER_TYPE& buffer, 
                                    const ::EmbeddedProto::WireFormatter::WireType& wire_type)
       {
         Error return_value = WIRETYPE == wire_type ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
@@ -165,6 +194,20 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      //! Check the serialized value of this field without storing it, see the generated validate().
+      /*!
+        The value is decoded into a temporary so exactly the same checks are made as when 
+        deserializing. The depth is not used by scalar fields.
+      */
+      template<class BUFFER_TYPE>
+      static Error validate_check_type(BUFFER_TYPE& buffer, 
+                                       const ::EmbeddedProto::WireFormatter::WireType& wire_type,
+                                       [[maybe_unused]] const uint32_t depth)
+      {
+        CLASS_TYPE value;
+        return value.deserialize_check_type(buffer, wire_type);
+      }
+
       void set(const VARIABLE_TYPE& v) { value_ = v; }      
       void set(const VARIABLE_TYPE&& v) { value_ = v; }
 
@@ -181,16 +224,8 @@ namespace EmbeddedProto
         value_ = v;
         return *this;
       }
-      CLASS_TYPE& operator=(const CLASS_TYPE& ft)
-      { 
-        value_ = ft.value_; 
-        return *this; 
-      }
-      CLASS_TYPE& operator=(const CLASS_TYPE&& ft) noexcept
-      { 
-        value_ = ft.value_;
-        return *this;
-      }
+      CLASS_TYPE& operator=(const CLASS_TYPE& ft) = default;
+      CLASS_TYPE& operator=(CLASS_TYPE&& ft) = default;
 
       const VARIABLE_TYPE& get() const { return value_; }
       VARIABLE_TYPE& get() { return value_; }
@@ -202,28 +237,31 @@ namespace EmbeddedProto
       */
       operator VARIABLE_TYPE() const { return value_; } //NOSONAR
 
-      bool operator==(const VARIABLE_TYPE& rhs) { return value_ == rhs; }
-      bool operator!=(const VARIABLE_TYPE& rhs) { return value_ != rhs; }
-      bool operator>(const VARIABLE_TYPE& rhs) { return value_ > rhs; }
-      bool operator<(const VARIABLE_TYPE& rhs) { return value_ < rhs; }
-      bool operator>=(const VARIABLE_TYPE& rhs) { return value_ >= rhs; }
-      bool operator<=(const VARIABLE_TYPE& rhs) { return value_ <= rhs; }
+      bool operator==(const VARIABLE_TYPE& rhs) const { return value_ == rhs; }
+      bool operator!=(const VARIABLE_TYPE& rhs) const { return value_ != rhs; }
+      bool operator>(const VARIABLE_TYPE& rhs) const { return value_ > rhs; }
+      bool operator<(const VARIABLE_TYPE& rhs) const { return value_ < rhs; }
+      bool operator>=(const VARIABLE_TYPE& rhs) const { return value_ >= rhs; }
+      bool operator<=(const VARIABLE_TYPE& rhs) const { return value_ <= rhs; }
 
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator==(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ == rhs.get(); }
+      bool operator==(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ == rhs.get(); }
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator!=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ != rhs.get(); }
+      bool operator!=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ != rhs.get(); }
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator>(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ > rhs.get(); }
+      bool operator>(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ > rhs.get(); }
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator<(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ < rhs.get(); }
+      bool operator<(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ < rhs.get(); }
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator>=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ >= rhs.get(); }
+      bool operator>=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ >= rhs.get(); }
       template<Field::FieldTypes FIELDTYPE_RHS, class TYPE_RHS, WireFormatter::WireType WIRETYPE_RHS>
-      bool operator<=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) { return value_ <= rhs.get(); }
+      bool operator<=(const FieldTemplate<FIELDTYPE_RHS, TYPE_RHS, WIRETYPE_RHS>& rhs) const { return value_ <= rhs.get(); }
 
       void clear() { value_ = static_cast<VARIABLE_TYPE>(0); }
 
+      //! Mix the value of this field into the given hash.
+      uint64_t hash(const uint64_t seed) const { return Hash::value(seed, value_); }
+
       uint32_t serialized_size() const
       {
         ::EmbeddedProto::MessageSizeCalculator calcBuffer;
@@ -336,77 +374,77 @@ namespace EmbeddedProto
       VARIABLE_TYPE value_;
 
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int32 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint32_t>(get()), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int32 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint32_t>(get()), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int64 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint64_t>(get()), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int64 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint64_t>(get()), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint32 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint32 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint64 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint64 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint32 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(WireFormatter::ZigZagEncode(get()), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint32 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(WireFormatter::ZigZagEncode(get()), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint64 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(WireFormatter::ZigZagEncode(get()), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint64 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(WireFormatter::ZigZagEncode(get()), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::boolean == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const 
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::boolean == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const 
       { 
         const uint8_t byte = get() ? 0x01 : 0x00;
         return buffer.push(byte) ? Error::NO_ERRORS : Error::BUFFER_FULL; 
       }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::enumeration == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint32_t>(get()), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::enumeration == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeVarint(static_cast<uint32_t>(get()), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed32 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeFixedNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed32 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeFixedNoTag(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed64 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerializeFixedNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed64 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerializeFixedNoTag(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed32 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerialzieSFixedNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed32 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerialzieSFixedNoTag(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed64 == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerialzieSFixedNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed64 == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerialzieSFixedNoTag(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::floatfixed == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerialzieFloatNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::floatfixed == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerialzieFloatNoTag(get(), buffer); }
 
-      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::doublefixed == SER_FIELDTYPE, bool>::type = true>
-      Error serialize_(WriteBufferInterface& buffer) const { return WireFormatter::SerialzieDoubleNoTag(get(), buffer); }
+      template<Field::FieldTypes SER_FIELDTYPE, typename std::enable_if<Field::FieldTypes::doublefixed == SER_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error serialize_(BUFFER_TYPE& buffer) const { return WireFormatter::SerialzieDoubleNoTag(get(), buffer); }
 
 
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int32 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int32 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int64 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::int64 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint32 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeUInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint32 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeUInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint64 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeUInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::uint64 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeUInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint32 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeSInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint32 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeSInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint64 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeSInt(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sint64 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeSInt(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::boolean == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeBool(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::boolean == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeBool(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::enumeration == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer)
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::enumeration == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer)
       { 
         uint32_t value = 0;
         const Error return_value = WireFormatter::DeserializeVarint(buffer, value);
@@ -417,23 +455,23 @@ namespace EmbeddedProto
         return return_value;
       }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed32 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeFixed(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed32 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeFixed(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed64 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeFixed(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::fixed64 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeFixed(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed32 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeSFixed(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed32 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeSFixed(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed64 == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeSFixed(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::sfixed64 == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeSFixed(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::floatfixed == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeFloat(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::floatfixed == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeFloat(buffer, get()); }
 
-      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::doublefixed == DES_FIELDTYPE, bool>::type = true>
-      Error deserialize_(ReadBufferInterface& buffer) { return WireFormatter::DeserializeDouble(buffer, get()); }
+      template<Field::FieldTypes DES_FIELDTYPE, typename std::enable_if<Field::FieldTypes::doublefixed == DES_FIELDTYPE, bool>::type = true, class BUFFER_TYPE>
+      Error deserialize_(BUFFER_TYPE& buffer) { return WireFormatter::DeserializeDouble(buffer, get()); }
 
   };
 
@@ -455,5 +493,21 @@ namespace EmbeddedProto
   template<class ENUM_TYPE>
   using enumeration = FieldTemplate<Field::FieldTypes::enumeration, ENUM_TYPE, WireFormatter::WireType::VARINT>;
 
+  // The scalar fields are trivially copyable which allows messages and arrays holding only these
+  // fields to be copied as a block of memory.
+  static_assert(std::is_trivially_copyable<int32>::value, "int32 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int64>::value, "int64 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint32>::value, "uint32 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint64>::value, "uint64 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<sint32>::value, "sint32 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<sint64>::value, "sint64 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<boolean>::value, "boolean should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<fixed32>::value, "fixed32 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<fixed64>::value, "fixed64 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<sfixed32>::value, "sfixed32 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<sfixed64>::value, "sfixed64 should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<floatfixed>::value, "floatfixed should be trivially copyable.");
+  static_assert(std::is_trivially_copyable<doublefixed>::value, "doublefixed should be trivially copyable.");
+
 } // End of namespace EmbeddedProto.
 #endif
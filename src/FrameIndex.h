@@ -0,0 +1,204 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _FRAME_INDEX_H_
+#define _FRAME_INDEX_H_
+
+#include "Errors.h"
+#include "WireFormatter.h"
+#include "ReadBufferView.h"
+
+#include <cstdint>
+#include <algorithm>
+#include <array>
+
+
+namespace EmbeddedProto
+{
+
+  //! A table with the location of each message in a stream of length delimited messages.
+  /*!
+    The stream holds messages each preceded by their size as a varint, as written by 
+    serialize_batch(). The index is build by reading only the sizes. Afterwards each frame can be 
+    decoded independently of the others.
+
+    Decoding only reads the index and the data. Different ranges of frames can therefore be decoded 
+    at the same time, for example by multiple threads or tasks, as long as each uses its own message 
+    object. The index itself does not start any threads.
+
+    The data is not copied, it should stay valid and unchanged while the index is used.
+
+    \tparam MAX_N_FRAMES The maximum number of frames which can be indexed at once.
+  */
+  template<uint32_t MAX_N_FRAMES>
+  class FrameIndex
+  {
+    public:
+
+      //! The location of a single message in the data.
+      struct Frame
+      {
+        //! The offset of the first byte of the message, after the size.
+        uint32_t offset;
+
+        //! The number of bytes of the message.
+        uint32_t size;
+      };
+
+      FrameIndex() = default;
+      ~FrameIndex() = default;
+
+      //! Walk through the data and record the location of each message.
+      /*!
+        When the data holds more than MAX_N_FRAMES messages, the first MAX_N_FRAMES are indexed and 
+        ARRAY_FULL is returned. Use get_n_bytes() to find where to continue with the next build.
+
+        \param[in] data Pointer to the size of the first message.
+        \param[in] size The number of bytes in the data.
+        \return NO_ERRORS when all data has been indexed. END_OF_BUFFER when the last message is 
+                incomplete, the messages before it are indexed.
+      */
+      Error build(const uint8_t* data, const uint32_t size)
+      {
+        clear();
+        data_ = data;
+
+        ReadBufferView buffer(data, size);
+        Error return_value = Error::NO_ERRORS;
+        while((Error::NO_ERRORS == return_value) && (0 < buffer.get_size()))
+        {
+          if(MAX_N_FRAMES > n_frames_)
+          {
+            uint32_t n_bytes = 0;
+            return_value = WireFormatter::DeserializeVarint(buffer, n_bytes);
+            if(Error::NO_ERRORS == return_value)
+            {
+              const uint32_t offset = size - buffer.get_size();
+              if(buffer.advance(n_bytes))
+              {
+                frames_[n_frames_] = {offset, n_bytes};
+                ++n_frames_;
+                n_bytes_ = offset + n_bytes;
+              }
+              else
+              {
+                return_value = Error::END_OF_BUFFER;
+              }
+            }
+          }
+          else
+          {
+            return_value = Error::ARRAY_FULL;
+          }
+        }
+        return return_value;
+      }
+
+      //! Remove all frames.
+      void clear()
+      {
+        data_ = nullptr;
+        n_frames_ = 0;
+        n_bytes_ = 0;
+      }
+
+      //! Obtain the number of frames indexed.
+      uint32_t get_n_frames() const { return n_frames_; }
+
+      //! Obtain the maximum number of frames which can be indexed.
+      uint32_t get_max_n_frames() const { return MAX_N_FRAMES; }
+
+      //! Obtain the number of bytes from the start of the data up to the end of the last frame indexed.
+      uint32_t get_n_bytes() const { return n_bytes_; }
+
+      //! Obtain the frame at the given index.
+      const Frame& get_frame(const uint32_t index) const
+      {
+        return frames_[std::min(index, MAX_N_FRAMES-1)];
+      }
+
+      //! Clear the message and decode the frame at the given index into it.
+      template<class MESSAGE_TYPE>
+      Error deserialize(const uint32_t index, MESSAGE_TYPE& message) const
+      {
+        Error return_value = Error::INDEX_OUT_OF_BOUND;
+        if(index < n_frames_)
+        {
+          ReadBufferView buffer(data_ + frames_[index].offset, frames_[index].size);
+          message.clear();
+          return_value = message.deserialize(buffer);
+        }
+        return return_value;
+      }
+
+      //! Decode a range of frames one after the other and pass each message to the callback.
+      /*!
+        \param[in] first The index of the first frame to decode.
+        \param[in] count The number of frames to decode, limited to the frames available.
+        \param[out] message The message object used to decode each frame in.
+        \param[in] callback Called as callback(index, message) after each frame is decoded.
+        \return NO_ERRORS when all frames have been decoded, otherwise the error of the first frame 
+                which failed. The callback is not called for this frame.
+      */
+      template<class MESSAGE_TYPE, class CALLBACK_TYPE>
+      Error decode(const uint32_t first, const uint32_t count, MESSAGE_TYPE& message, 
+                   CALLBACK_TYPE&& callback) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        const uint32_t last = (first < n_frames_) ? first + std::min(count, n_frames_ - first) : first;
+        for(uint32_t i = first; (i < last) && (Error::NO_ERRORS == return_value); ++i)
+        {
+          return_value = deserialize(i, message);
+          if(Error::NO_ERRORS == return_value)
+          {
+            callback(i, static_cast<const MESSAGE_TYPE&>(message));
+          }
+        }
+        return return_value;
+      }
+
+    private:
+
+      //! The serialized data.
+      const uint8_t* data_ = nullptr;
+
+      //! The number of frames indexed.
+      uint32_t n_frames_ = 0;
+
+      //! The number of bytes up to the end of the last frame.
+      uint32_t n_bytes_ = 0;
+
+      //! The location of each frame.
+      std::array<Frame, MAX_N_FRAMES> frames_ = {};
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _FRAME_INDEX_H_
@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _HASH_H_
+#define _HASH_H_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace EmbeddedProto
+{
+
+  //! Functions to calculate a non cryptographic hash of the content of a message.
+  /*!
+    Values are mixed in one after the other using a 64 bit multiply and xor shift, in the style of 
+    xxh3. Only 64 bit multiplications are used so this is also reasonably fast on 32 bit targets. 
+    The result is the same for equal messages but it is not suitable to protect data against 
+    tampering.
+  */
+  namespace Hash
+  {
+    //! The initial value used when hashing a message.
+    static constexpr uint64_t SEED = 0x9E3779B97F4A7C15ULL;
+
+    static constexpr uint64_t PRIME_1 = 0x9FB21C651E98DF25ULL;
+    static constexpr uint64_t PRIME_2 = 0x165667919E3779F9ULL;
+
+    //! Mix a single 64 bit value into the hash.
+    inline uint64_t combine(uint64_t hash, const uint64_t value)
+    {
+      hash = (hash ^ value) * PRIME_1;
+      return hash ^ (hash >> 32);
+    }
+
+    //! Mix an array of bytes into the hash, eight bytes at a time.
+    inline uint64_t bytes(uint64_t hash, const uint8_t* data, const uint32_t length)
+    {
+      uint32_t i = 0;
+      for(; (i + sizeof(uint64_t)) <= length; i += sizeof(uint64_t))
+      {
+        uint64_t word = 0;
+        memcpy(&word, data + i, sizeof(uint64_t));
+        hash = combine(hash, word);
+      }
+
+      uint64_t tail = 0;
+      if(i < length)
+      {
+        memcpy(&tail, data + i, length - i);
+      }
+      // Include the length so trailing zeros give a different result.
+      return combine(hash, tail ^ (static_cast<uint64_t>(length) << 56));
+    }
+
+    //! Spread the bits of the hash, called once after all values have been mixed in.
+    inline uint64_t finalize(uint64_t hash)
+    {
+      hash ^= hash >> 37;
+      hash *= PRIME_2;
+      return hash ^ (hash >> 32);
+    }
+
+    //! Mix an integer, boolean or enum value into the hash.
+    template<class TYPE>
+    typename std::enable_if<std::is_integral<TYPE>::value || std::is_enum<TYPE>::value, uint64_t>::type 
+    value(const uint64_t hash, const TYPE& v)
+    {
+      return combine(hash, static_cast<uint64_t>(v));
+    }
+
+    //! Mix a floating point value into the hash, positive and negative zero give the same result.
+    template<class TYPE>
+    typename std::enable_if<std::is_floating_point<TYPE>::value, uint64_t>::type 
+    value(const uint64_t hash, const TYPE& v)
+    {
+      uint64_t bits = 0;
+      if(static_cast<TYPE>(0) != v)
+      {
+        memcpy(&bits, &v, sizeof(TYPE));
+      }
+      return combine(hash, bits);
+    }
+
+    //! Mix a field, array or message into the hash using its own hash function.
+    template<class TYPE>
+    auto value(const uint64_t hash, const TYPE& v) -> decltype(v.hash(hash))
+    {
+      return v.hash(hash);
+    }
+
+  } // End of namespace Hash
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _HASH_H_
@@ -0,0 +1,262 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _LAZY_MESSAGE_H_
+#define _LAZY_MESSAGE_H_
+
+#include "Defines.h"
+#include "Errors.h"
+#include "WireFormatter.h"
+#include "ReadBufferSection.h"
+#include "ReadBufferView.h"
+
+#include <cstdint>
+#include <utility>
+
+
+namespace EmbeddedProto
+{
+
+  //! A nested message field which is only decoded when it is accessed.
+  /*!
+    When deserialized from a buffer which keeps its data, like ReadBufferView, only a pointer to the 
+    serialized bytes of the nested message is stored. The message is decoded on the first call to 
+    get() or get_mutable(). As long as the message is not changed the stored bytes are serialized 
+    again as is. Other buffers return no persistent data, the message is then decoded directly.
+
+    The data in the buffer should stay valid and unchanged for as long as this object is used.
+
+    This class is not thread safe, not even for const access. The first call to get() or decode() 
+    writes the decoded message into this object. Decode the message before sharing it between 
+    threads.
+  */
+  template<class MESSAGE_TYPE>
+  class LazyMessage
+  {
+    public:
+
+      LazyMessage() = default;
+      ~LazyMessage() = default;
+
+      LazyMessage(const LazyMessage<MESSAGE_TYPE>& rhs) = default;
+      LazyMessage(LazyMessage<MESSAGE_TYPE>&& rhs) = default;
+      LazyMessage<MESSAGE_TYPE>& operator=(const LazyMessage<MESSAGE_TYPE>& rhs) = default;
+      LazyMessage<MESSAGE_TYPE>& operator=(LazyMessage<MESSAGE_TYPE>&& rhs) = default;
+
+      //! Replace the content by the given message, any stored bytes are dropped.
+      LazyMessage<MESSAGE_TYPE>& operator=(const MESSAGE_TYPE& rhs)
+      {
+        message_ = rhs;
+        drop_data();
+        decode_result_ = Error::NO_ERRORS;
+        return *this;
+      }
+
+      //! Replace the content by the given message, any stored bytes are dropped.
+      LazyMessage<MESSAGE_TYPE>& operator=(MESSAGE_TYPE&& rhs)
+      {
+        message_ = std::move(rhs);
+        drop_data();
+        decode_result_ = Error::NO_ERRORS;
+        return *this;
+      }
+
+      //! Obtain the message, decoding it first when this has not been done yet.
+      /*!
+        Errors while decoding result in a cleared message. Use get(Error&) or decode() to obtain the 
+        error.
+      */
+      const MESSAGE_TYPE& get() const
+      {
+        decode();
+        return message_;
+      }
+
+      //! Obtain the message, decoding it first when this has not been done yet.
+      /*!
+        \param[out] result The result of decoding the message, see decode().
+        \return The message, cleared when decoding failed.
+      */
+      const MESSAGE_TYPE& get(Error& result) const
+      {
+        result = decode();
+        return message_;
+      }
+
+      //! Obtain the message to change it. The stored bytes are no longer serialized.
+      MESSAGE_TYPE& get_mutable()
+      {
+        decode();
+        drop_data();
+        return message_;
+      }
+
+      //! Decode the stored bytes into the message if this has not been done yet.
+      /*!
+        Only the first call after deserialization decodes the data. The result is kept, later calls 
+        return the same error until the message is cleared or assigned.
+        \return The result of decoding the data.
+      */
+      Error decode() const
+      {
+        if(pending_)
+        {
+          pending_ = false;
+          ReadBufferView view(data_, data_size_);
+          decode_result_ = message_.deserialize(view);
+          if(Error::NO_ERRORS != decode_result_)
+          {
+            message_.clear();
+          }
+        }
+        return decode_result_;
+      }
+
+      //! Returns true when the stored bytes have not been decoded yet.
+      bool is_pending() const { return pending_; }
+
+      void clear()
+      {
+        message_.clear();
+        data_ = nullptr;
+        data_size_ = 0;
+        pending_ = false;
+        untouched_ = true;
+        decode_result_ = Error::NO_ERRORS;
+      }
+
+      //! Serialize the stored bytes if there are any, otherwise serialize the message.
+      template<class BUFFER_TYPE>
+      Error serialize_with_id(uint32_t field_number, BUFFER_TYPE& buffer, const bool optional) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        if(nullptr == data_)
+        {
+          return_value = message_.serialize_with_id(field_number, buffer, optional);
+        }
+        else if((0 < data_size_) || optional)
+        {
+          return_value = WireFormatter::SerializeVarint(WireFormatter::MakeTag(field_number, 
+                                                        WireFormatter::WireType::LENGTH_DELIMITED), buffer);
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::SerializeVarint(data_size_, buffer);
+          }
+          if((Error::NO_ERRORS == return_value) && !buffer.push(data_, data_size_))
+          {
+            return_value = Error::BUFFER_FULL;
+          }
+        }
+        return return_value;
+      }
+
+      //! Store the bytes of the nested message when the buffer allows it, otherwise decode them.
+      /*!
+        Only a message which has not been changed since it was cleared is stored lazily. In all other
+        cases the data is merged into the decoded message as usual.
+      */
+      template<class BUFFER_TYPE>
+      Error deserialize_check_type(BUFFER_TYPE& buffer, const WireFormatter::WireType& wire_type)
+      {
+        Error return_value = WireFormatter::WireType::LENGTH_DELIMITED == wire_type 
+                             ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
+        uint32_t size = 0;
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = WireFormatter::DeserializeVarint(buffer, size);
+        }
+
+        if(Error::NO_ERRORS == return_value)
+        {
+          const uint8_t* data = (untouched_ && (nullptr == data_)) ? buffer.get_persistent_data(size) : nullptr;
+          if(nullptr != data)
+          {
+            buffer.advance(size);
+            data_ = data;
+            data_size_ = size;
+            pending_ = true;
+          }
+          else
+          {
+            // Decode earlier data first as the new data is merged into it.
+            return_value = decode();
+            if(Error::NO_ERRORS == return_value)
+            {
+              ReadBufferSection bufferSection(buffer, size);
+              return_value = message_.deserialize(bufferSection);
+            }
+            drop_data();
+          }
+        }
+        return return_value;
+      }
+
+#ifdef MSG_TO_STRING
+
+      ::EmbeddedProto::string_view to_string(::EmbeddedProto::string_view& str, const uint32_t indent_level, char const* name, const bool first_field) const
+      {
+        return get().to_string(str, indent_level, name, first_field);
+      }
+
+#endif // End of MSG_TO_STRING
+
+    private:
+
+      //! Forget the stored bytes after the message has been changed.
+      void drop_data()
+      {
+        data_ = nullptr;
+        data_size_ = 0;
+        pending_ = false;
+        untouched_ = false;
+      }
+
+      //! The message itself, decoded on first access.
+      mutable MESSAGE_TYPE message_;
+
+      //! Pointer to the serialized bytes of the message, nullptr when there are none.
+      const uint8_t* data_ = nullptr;
+
+      //! The number of serialized bytes.
+      uint32_t data_size_ = 0;
+
+      //! True when the serialized bytes have not been decoded into message_ yet.
+      mutable bool pending_ = false;
+
+      //! True when message_ has not been changed since it was constructed or cleared.
+      bool untouched_ = true;
+
+      //! The result of decoding the stored bytes.
+      mutable Error decode_result_ = Error::NO_ERRORS;
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _LAZY_MESSAGE_H_
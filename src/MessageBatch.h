@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _MESSAGE_BATCH_H_
+#define _MESSAGE_BATCH_H_
+
+#include "Errors.h"
+#include "WireFormatter.h"
+#include "MessageSizeCalculator.h"
+#include "ReadBufferSection.h"
+
+#include <cstdint>
+
+
+namespace EmbeddedProto
+{
+
+  //! Serialize an array of messages, each preceded by its size as a varint.
+  /*!
+    This is the same framing as used by writeDelimitedTo() in other protobuf implementations. The 
+    messages are serialized with the concrete buffer type so the buffer calls can be inlined. 
+
+    \param[in] messages Pointer to the first message.
+    \param[in] n_messages The number of messages in the array.
+    \param[out] buffer The buffer to which the messages are written.
+    \param[out] n_serialized The number of messages which have been written completely.
+    \return Error::NO_ERRORS when all messages have been serialized. Error::BUFFER_FULL when the 
+            buffer does not have enough space left for the next message including its size. The 
+            messages before have been written, nothing of the message which did not fit.
+  */
+  template<class MESSAGE_TYPE, class BUFFER_TYPE>
+  Error serialize_batch(const MESSAGE_TYPE* messages, const uint32_t n_messages, BUFFER_TYPE& buffer,
+                        uint32_t& n_serialized)
+  {
+    Error return_value = Error::NO_ERRORS;
+    n_serialized = 0;
+    MessageSizeCalculator calculator;
+    for(uint32_t i = 0; (i < n_messages) && (Error::NO_ERRORS == return_value); ++i)
+    {
+      calculator.clear();
+      static_cast<void>(messages[i].serialize(calculator));
+      const uint32_t size = calculator.get_size();
+
+      // Only start writing when both the size and the message fit.
+      if((WireFormatter::VarintSize(size) + size) > buffer.get_available_size())
+      {
+        return_value = Error::BUFFER_FULL;
+      }
+      else
+      {
+        return_value = WireFormatter::SerializeVarint(size, buffer);
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = messages[i].serialize(buffer);
+        }
+        if(Error::NO_ERRORS == return_value)
+        {
+          ++n_serialized;
+        }
+      }
+    }
+    return return_value;
+  }
+
+  //! Deserialize messages written by serialize_batch() until the buffer is empty.
+  /*!
+    Each message is cleared before it is deserialized.
+
+    \param[in] buffer The buffer from which the messages are read.
+    \param[out] messages Pointer to the first message of the array to store the result in.
+    \param[in] max_n_messages The number of messages in the array.
+    \param[out] n_messages The number of messages which have been deserialized.
+    \return Error::NO_ERRORS when all data in the buffer has been read. Error::ARRAY_FULL when there 
+            is more data than messages in the array. Error::END_OF_BUFFER when the buffer ends 
+            before the last message. Otherwise the error of the message which failed, n_messages 
+            does not include this message.
+  */
+  template<class MESSAGE_TYPE, class BUFFER_TYPE>
+  Error deserialize_batch(BUFFER_TYPE& buffer, MESSAGE_TYPE* messages, const uint32_t max_n_messages,
+                          uint32_t& n_messages)
+  {
+    Error return_value = Error::NO_ERRORS;
+    n_messages = 0;
+    uint8_t byte = 0;
+    while((Error::NO_ERRORS == return_value) && buffer.peek(byte))
+    {
+      if(max_n_messages <= n_messages)
+      {
+        return_value = Error::ARRAY_FULL;
+      }
+      else
+      {
+        uint32_t size = 0;
+        return_value = WireFormatter::DeserializeVarint(buffer, size);
+        if(Error::NO_ERRORS == return_value)
+        {
+          ReadBufferSection section(buffer, size);
+          // Buffers which report the bytes left limit the section to them, a shorter section means 
+          // the frame is cut off.
+          if(section.get_max_size() < size)
+          {
+            return_value = Error::END_OF_BUFFER;
+          }
+          else
+          {
+            MESSAGE_TYPE& message = messages[n_messages];
+            message.clear();
+            return_value = message.deserialize(section);
+            // Skip any bytes left in this message to stay aligned with the next. When these bytes 
+            // are not there the frame is cut off as well.
+            if(!section.advance(section.get_size()) && (Error::NO_ERRORS == return_value))
+            {
+              return_value = Error::END_OF_BUFFER;
+            }
+            if(Error::NO_ERRORS == return_value)
+            {
+              ++n_messages;
+            }
+          }
+        }
+      }
+    }
+    return return_value;
+  }
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _MESSAGE_BATCH_H_
@@ -0,0 +1,367 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _MESSAGE_INDEX_H_
+#define _MESSAGE_INDEX_H_
+
+#include "Errors.h"
+#include "WireFormatter.h"
+#include "MessageInterface.h"
+#include "ReadBufferView.h"
+
+#include <cstdint>
+#include <algorithm>
+#include <array>
+
+
+namespace EmbeddedProto
+{
+
+  //! A table with the location of each field in a serialized message.
+  /*!
+    The index is build by walking once through the serialized data, reading the tags and skipping 
+    the values. Afterwards single fields, or the fields of a nested message, can be decoded without 
+    decoding the rest of the message. This is useful when only a few fields are needed, for example 
+    to route or filter messages.
+
+    The data is not copied, it should stay valid and unchanged while the index is used.
+
+    \tparam MAX_N_FIELDS The maximum number of fields which can be indexed. Each element of an 
+            unpacked repeated field counts as a field.
+  */
+  template<uint32_t MAX_N_FIELDS>
+  class MessageIndex
+  {
+    public:
+
+      //! The location of a single field in the serialized data.
+      struct Entry
+      {
+        //! The field number as read from the tag.
+        uint32_t field_number;
+
+        //! The wire type as read from the tag.
+        WireFormatter::WireType wire_type;
+
+        //! The offset of the first byte after the tag, from the start of the data given to build().
+        //! For length delimited fields this is the length.
+        uint32_t offset;
+
+        //! The number of bytes after the tag, including the length of length delimited fields.
+        uint32_t size;
+      };
+
+      MessageIndex() = default;
+      ~MessageIndex() = default;
+
+      //! Walk through the serialized data and record the location of each field.
+      /*!
+        When the data holds more than MAX_N_FIELDS fields, the first MAX_N_FIELDS are indexed and 
+        ARRAY_FULL is returned.
+
+        \param[in] data Pointer to the first byte of the serialized message.
+        \param[in] size The number of bytes in the serialized message.
+        \return NO_ERRORS when the whole message has been indexed.
+      */
+      Error build(const uint8_t* data, const uint32_t size)
+      {
+        clear();
+        data_ = data;
+        return append(0, size);
+      }
+
+      //! Remove all entries.
+      void clear()
+      {
+        data_ = nullptr;
+        n_entries_ = 0;
+      }
+
+      //! Obtain the number of fields indexed.
+      uint32_t get_n_entries() const { return n_entries_; }
+
+      //! Obtain the maximum number of fields which can be indexed.
+      uint32_t get_max_n_entries() const { return MAX_N_FIELDS; }
+
+      //! Obtain the entry at the given index, in the order in which the fields where serialized.
+      const Entry& get_entry(const uint32_t index) const
+      {
+        return entries_[std::min(index, MAX_N_FIELDS-1)];
+      }
+
+      //! Find the last occurrence of a field.
+      /*!
+        \return The entry of the field or nullptr when the field is not in the data.
+      */
+      const Entry* find(const uint32_t field_number) const
+      {
+        const Entry* result = nullptr;
+        for(uint32_t i = 0; i < n_entries_; ++i)
+        {
+          if(field_number == entries_[i].field_number)
+          {
+            result = &(entries_[i]);
+          }
+        }
+        return result;
+      }
+
+      //! Returns true when the field is present in the data.
+      bool has(const uint32_t field_number) const
+      {
+        return nullptr != find(field_number);
+      }
+
+      //! Obtain the number of times a field occurs in the data.
+      uint32_t count(const uint32_t field_number) const
+      {
+        uint32_t result = 0;
+        for(uint32_t i = 0; i < n_entries_; ++i)
+        {
+          if(field_number == entries_[i].field_number)
+          {
+            ++result;
+          }
+        }
+        return result;
+      }
+
+      //! Decode the given field.
+      /*!
+        All occurrences of the field are decoded into the given object. This follows the normal 
+        deserialization rules: the last value of a scalar is used, repeated fields are appended and 
+        messages are merged.
+
+        \param[in] field_number The number of the field to decode.
+        \param[out] field The object to decode into, for example a EmbeddedProto::int32 or a message.
+        \return INVALID_FIELD_ID when the field is not in the data, otherwise the result of decoding.
+      */
+      template<class FIELD_TYPE>
+      Error get(const uint32_t field_number, FIELD_TYPE& field) const
+      {
+        Error return_value = Error::INVALID_FIELD_ID;
+        bool found = false;
+        for(uint32_t i = 0; (i < n_entries_) && (!found || (Error::NO_ERRORS == return_value)); ++i)
+        {
+          if(field_number == entries_[i].field_number)
+          {
+            found = true;
+            return_value = deserialize(entries_[i], field);
+          }
+        }
+        return return_value;
+      }
+
+      //! Clear the repeated field and add a cleared element for each occurrence of the field.
+      /*!
+        This prepares an array of messages, strings or bytes for get_elements().
+
+        \return ARRAY_FULL when the field occurs more often than fit in the array, the array is then 
+                filled completely.
+      */
+      template<class REPEATED_TYPE>
+      Error prepare_elements(const uint32_t field_number, REPEATED_TYPE& field) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        field.clear();
+        const uint32_t n = count(field_number);
+        for(uint32_t i = 0; (i < n) && (Error::NO_ERRORS == return_value); ++i)
+        {
+          if(nullptr == field.add_new())
+          {
+            return_value = Error::ARRAY_FULL;
+          }
+        }
+        return return_value;
+      }
+
+      //! Decode a range of occurrences of a repeated field into the elements at the same position.
+      /*!
+        Call prepare_elements() once before. Each element only depends on its own bytes, different 
+        ranges of one array can therefore be decoded at the same time, for example by multiple 
+        threads. The elements are the same as after a normal deserialize() of the message.
+
+        \param[in] field_number The number of the repeated field.
+        \param[in] first The first occurrence to decode.
+        \param[in] n The number of occurrences to decode, limited to the length of the array.
+        \param[out] field The repeated field prepared by prepare_elements().
+        \return NO_ERRORS or the error of the first element in the range which failed.
+      */
+      template<class REPEATED_TYPE>
+      Error get_elements(const uint32_t field_number, const uint32_t first, const uint32_t n, 
+                         REPEATED_TYPE& field) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        const uint32_t last = (first < field.get_length()) ? first + std::min(n, field.get_length() - first) : first;
+        auto* elements = field.data();
+        uint32_t occurrence = 0;
+        for(uint32_t i = 0; (i < n_entries_) && (occurrence < last) && (Error::NO_ERRORS == return_value); ++i)
+        {
+          if(field_number == entries_[i].field_number)
+          {
+            if(first <= occurrence)
+            {
+              return_value = deserialize(entries_[i], elements[occurrence]);
+            }
+            ++occurrence;
+          }
+        }
+        return return_value;
+      }
+
+      //! Decode the field at the location of the entry.
+      template<class FIELD_TYPE>
+      Error deserialize(const Entry& entry, FIELD_TYPE& field) const
+      {
+        ReadBufferView buffer(data_ + entry.offset, entry.size);
+        return field.deserialize_check_type(buffer, entry.wire_type);
+      }
+
+      //! Build an index of a nested message.
+      /*!
+        All occurrences of the message field are indexed, in order. Decoding a field from the nested 
+        index therefore merges the occurrences just like deserialize() does.
+
+        \param[in] field_number The number of the message field.
+        \param[out] nested The index to build over the bytes of the nested message.
+        \return INVALID_FIELD_ID when the field is not in the data, INVALID_WIRETYPE when it is not 
+                length delimited, otherwise the result of building the nested index.
+      */
+      template<uint32_t NESTED_MAX_N_FIELDS>
+      Error get_nested(const uint32_t field_number, MessageIndex<NESTED_MAX_N_FIELDS>& nested) const
+      {
+        Error return_value = Error::INVALID_FIELD_ID;
+        nested.clear();
+        // The entries of the nested index point into the same data as this index.
+        nested.data_ = data_;
+        bool found = false;
+        for(uint32_t i = 0; (i < n_entries_) && (!found || (Error::NO_ERRORS == return_value)); ++i)
+        {
+          const Entry& entry = entries_[i];
+          if(field_number == entry.field_number)
+          {
+            found = true;
+            if(WireFormatter::WireType::LENGTH_DELIMITED != entry.wire_type)
+            {
+              return_value = Error::INVALID_WIRETYPE;
+            }
+            else
+            {
+              ReadBufferView buffer(data_ + entry.offset, entry.size);
+              uint32_t n_bytes = 0;
+              return_value = WireFormatter::DeserializeVarint(buffer, n_bytes);
+              if(Error::NO_ERRORS == return_value)
+              {
+                return_value = nested.append(entry.offset + (entry.size - n_bytes), n_bytes);
+              }
+            }
+          }
+        }
+        return return_value;
+      }
+
+    private:
+
+      // Indexes of other sizes fill in nested indexes.
+      template<uint32_t OTHER_MAX_N_FIELDS>
+      friend class MessageIndex;
+
+      //! Add the fields in size bytes from the given offset in data_ to the index.
+      Error append(const uint32_t start, const uint32_t size)
+      {
+        ReadBufferView buffer(data_ + start, size);
+        Error return_value = Error::NO_ERRORS;
+        WireFormatter::WireType wire_type = WireFormatter::WireType::VARINT;
+        uint32_t id_number = 0;
+
+        Error tag_value = WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+        while((Error::NO_ERRORS == return_value) && (Error::NO_ERRORS == tag_value))
+        {
+          const uint32_t offset = start + (size - buffer.get_size());
+          if(0 == id_number)
+          {
+            return_value = Error::INVALID_FIELD_ID;
+          }
+          else if(WireFormatter::WireType::LENGTH_DELIMITED == wire_type)
+          {
+            // Check if all bytes are there as the size of the field is recorded.
+            uint32_t n_bytes = 0;
+            return_value = WireFormatter::DeserializeVarint(buffer, n_bytes);
+            if((Error::NO_ERRORS == return_value) && !buffer.advance(n_bytes))
+            {
+              return_value = Error::END_OF_BUFFER;
+            }
+          }
+          else
+          {
+            return_value = MessageInterface::skip_unknown_field(buffer, wire_type);
+          }
+
+          if(Error::NO_ERRORS == return_value)
+          {
+            if(MAX_N_FIELDS > n_entries_)
+            {
+              entries_[n_entries_] = {id_number, wire_type, offset, (start + (size - buffer.get_size())) - offset};
+              ++n_entries_;
+
+              // Read the next tag.
+              tag_value = WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+            }
+            else
+            {
+              return_value = Error::ARRAY_FULL;
+            }
+          }
+        }
+
+        // The end of the buffer is expected after the last field.
+        if((Error::NO_ERRORS == return_value)
+           && (Error::NO_ERRORS != tag_value)
+           && (Error::END_OF_BUFFER != tag_value))
+        {
+          return_value = tag_value;
+        }
+
+        return return_value;
+      }
+
+      //! The serialized data.
+      const uint8_t* data_ = nullptr;
+
+      //! The number of fields indexed.
+      uint32_t n_entries_ = 0;
+
+      //! The location of each field.
+      std::array<Entry, MAX_N_FIELDS> entries_ = {};
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _MESSAGE_INDEX_H_
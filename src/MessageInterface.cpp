@@ -31,6 +31,7 @@
 #include "MessageInterface.h"
 #include "WireFormatter.h"
 #include "ReadBufferSection.h"
+#include "ReadBufferView.h"
 
 namespace EmbeddedProto
 {
@@ -91,7 +92,7 @@ namespace EmbeddedProto
 
 
   Error MessageInterface::skip_unknown_field(::EmbeddedProto::ReadBufferInterface& buffer,
-                                             const ::EmbeddedProto::WireFormatter::WireType& wire_type) const
+                                             const ::EmbeddedProto::WireFormatter::WireType& wire_type)
   {
     Error return_value = Error::NO_ERRORS;
 
@@ -113,6 +114,15 @@ namespace EmbeddedProto
         return_value = skip_fixed32(buffer);
         break;
 
+      case ::EmbeddedProto::WireFormatter::WireType::START_GROUP:
+        return_value = skip_group(buffer);
+        break;
+
+      case ::EmbeddedProto::WireFormatter::WireType::END_GROUP:
+        // An end without a start.
+        return_value = Error::INVALID_WIRETYPE;
+        break;
+
       default:
         // We should never get here. DeserializeTag catches this case.
         break;
@@ -122,34 +132,142 @@ namespace EmbeddedProto
   }
 
 
-  Error MessageInterface::skip_varint(::EmbeddedProto::ReadBufferInterface& buffer) const
+  Error MessageInterface::find_field(const uint8_t* data, const uint32_t size, const uint32_t field_number,
+                                     const ::EmbeddedProto::WireFormatter::WireType wire_type, uint32_t& offset)
   {
-    // Use a 64 bit variable to decode the maximum possible number of bytes. As we do not know
-    // the actual type.
-    uint64_t dummy;
-    return ::EmbeddedProto::WireFormatter::DeserializeVarint(buffer, dummy);
+    ::EmbeddedProto::ReadBufferView buffer(data, size);
+    Error return_value = Error::NO_ERRORS;
+    bool found = false;
+    ::EmbeddedProto::WireFormatter::WireType found_wire_type = wire_type;
+    ::EmbeddedProto::WireFormatter::WireType tag_wire_type = ::EmbeddedProto::WireFormatter::WireType::VARINT;
+    uint32_t id_number = 0;
+
+    Error tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, tag_wire_type, id_number);
+    while((Error::NO_ERRORS == return_value) && (Error::NO_ERRORS == tag_value))
+    {
+      if(0 == id_number)
+      {
+        return_value = Error::INVALID_FIELD_ID;
+      }
+      else
+      {
+        if(field_number == id_number)
+        {
+          found = true;
+          found_wire_type = tag_wire_type;
+          offset = size - buffer.get_size();
+        }
+        return_value = skip_unknown_field(buffer, tag_wire_type);
+      }
+
+      if(Error::NO_ERRORS == return_value)
+      {
+        tag_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, tag_wire_type, id_number);
+      }
+    }
+
+    if((Error::NO_ERRORS == return_value)
+       && (Error::NO_ERRORS != tag_value)
+       && (Error::END_OF_BUFFER != tag_value))
+    {
+      return_value = tag_value;
+    }
+
+    if(Error::NO_ERRORS == return_value)
+    {
+      if(!found)
+      {
+        return_value = Error::INVALID_FIELD_ID;
+      }
+      else if(wire_type != found_wire_type)
+      {
+        return_value = Error::INVALID_WIRETYPE;
+      }
+    }
+
+    return return_value;
   }
 
-  Error MessageInterface::skip_fixed32(::EmbeddedProto::ReadBufferInterface& buffer) const
+
+  Error MessageInterface::skip_varint(::EmbeddedProto::ReadBufferInterface& buffer)
   {
-    float dummy;
-    return ::EmbeddedProto::WireFormatter::DeserializeFloat(buffer, dummy);
+    // Only look for the last byte, which does not have the most significant bit set. There is no 
+    // need to decode the value.
+    constexpr uint8_t MSB = 0x80;
+    constexpr uint8_t MAX_N_BYTES = 10;
+    uint8_t byte = MSB;
+    uint8_t n_bytes = 0;
+    bool result = true;
+    while((MSB & byte) && (MAX_N_BYTES > n_bytes) && result)
+    {
+      result = buffer.pop(byte);
+      ++n_bytes;
+    }
+
+    Error return_value = Error::NO_ERRORS;
+    if(!result)
+    {
+      return_value = Error::END_OF_BUFFER;
+    }
+    else if(MSB & byte)
+    {
+      return_value = Error::OVERLONG_VARINT;
+    }
+    return return_value;
+  }
+
+  Error MessageInterface::skip_fixed32(::EmbeddedProto::ReadBufferInterface& buffer)
+  {
+    return buffer.advance(sizeof(uint32_t)) ? Error::NO_ERRORS : Error::END_OF_BUFFER;
   }
 
-  Error MessageInterface::skip_fixed64(::EmbeddedProto::ReadBufferInterface& buffer) const
+  Error MessageInterface::skip_fixed64(::EmbeddedProto::ReadBufferInterface& buffer)
   {
-    double dummy;
-    return ::EmbeddedProto::WireFormatter::DeserializeDouble(buffer, dummy);
+    return buffer.advance(sizeof(uint64_t)) ? Error::NO_ERRORS : Error::END_OF_BUFFER;
   }
 
-  Error MessageInterface::skip_length_delimited(::EmbeddedProto::ReadBufferInterface& buffer) const
+  Error MessageInterface::skip_length_delimited(::EmbeddedProto::ReadBufferInterface& buffer)
   {
     // First read the number of bytes 
     uint32_t n_bytes = 0;
-    const Error return_value = ::EmbeddedProto::WireFormatter::DeserializeVarint(buffer, n_bytes);
-    if(Error::NO_ERRORS == return_value)
+    Error return_value = ::EmbeddedProto::WireFormatter::DeserializeVarint(buffer, n_bytes);
+    if((Error::NO_ERRORS == return_value) && !buffer.advance(n_bytes))
     {
-      buffer.advance(n_bytes);
+      return_value = Error::END_OF_BUFFER;
+    }
+    return return_value;
+  }
+
+  Error MessageInterface::skip_group(::EmbeddedProto::ReadBufferInterface& buffer)
+  {
+    // Skip all fields up to the end of the group. Nested groups are tracked with a counter 
+    // instead of recursion to keep the stack usage fixed.
+    Error return_value = Error::NO_ERRORS;
+    uint32_t depth = 1;
+    ::EmbeddedProto::WireFormatter::WireType wire_type = ::EmbeddedProto::WireFormatter::WireType::VARINT;
+    uint32_t id_number = 0;
+    while((0 < depth) && (Error::NO_ERRORS == return_value))
+    {
+      return_value = ::EmbeddedProto::WireFormatter::DeserializeTag(buffer, wire_type, id_number);
+      if(Error::NO_ERRORS == return_value)
+      {
+        if(0 == id_number)
+        {
+          return_value = Error::INVALID_FIELD_ID;
+        }
+        else if(::EmbeddedProto::WireFormatter::WireType::START_GROUP == wire_type)
+        {
+          ++depth;
+        }
+        else if(::EmbeddedProto::WireFormatter::WireType::END_GROUP == wire_type)
+        {
+          --depth;
+        }
+        else
+        {
+          return_value = skip_unknown_field(buffer, wire_type);
+        }
+      }
     }
     return return_value;
   }
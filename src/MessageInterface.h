@@ -34,8 +34,10 @@
 #include "WireFormatter.h"
 #include "Fields.h"
 #include "Errors.h"
+#include "WriteBufferFixedSize.h"
 
 #include <cstdint>
+#include <cstring>
 
 
 namespace EmbeddedProto 
@@ -49,6 +51,13 @@ class MessageInterface : public ::EmbeddedProto::Field
 
     ~MessageInterface() override = default;
 
+    //! The maximum number of nested messages accepted by the generated validate() functions.
+    /*!
+      Each level of nesting is validated in a nested function call, this limits the stack usage on 
+      malicious data.
+    */
+    static constexpr uint32_t MAX_VALIDATE_DEPTH = 32;
+
     //! \see Field::serialize_with_id()
     Error serialize_with_id(uint32_t field_number, 
                             ::EmbeddedProto::WriteBufferInterface& buffer,
@@ -66,21 +75,73 @@ class MessageInterface : public ::EmbeddedProto::Field
         The defaults are to be set according to the Protobuf standard.
     */
     void clear() override = 0;
-    
 
-  protected:
     //! When deserializing skip the bytes in the buffer of an unknown field.
     /*! 
         This function is used when a field with an unknown id is encountered to move through the 
-        buffer to the next tag.
+        buffer to the next tag. It does not depend on the message and is also used to walk through 
+        serialized data without decoding it, see MessageIndex.
+    */
+    static Error skip_unknown_field(::EmbeddedProto::ReadBufferInterface& buffer, 
+                                    const ::EmbeddedProto::WireFormatter::WireType& wire_type);
+
+    //! Find the location of the value of a field in serialized data.
+    /*!
+        Only the top level fields are searched. When the field occurs multiple times the last 
+        occurrence is used, as this is the value used when deserializing.
+
+        \param[in] data Pointer to the first byte of the serialized message.
+        \param[in] size The number of bytes in the serialized message.
+        \param[in] field_number The number of the field to find.
+        \param[in] wire_type The expected wire type of the field.
+        \param[out] offset The offset of the first byte after the tag of the field.
+        \return INVALID_FIELD_ID when the field is not in the data, INVALID_WIRETYPE when the wire 
+                type does not match, otherwise the result of reading the data.
+    */
+    static Error find_field(const uint8_t* data, const uint32_t size, const uint32_t field_number,
+                            const ::EmbeddedProto::WireFormatter::WireType wire_type, uint32_t& offset);
+
+    //! Overwrite the value of a fixed width field in serialized data.
+    /*!
+        As the number of bytes of fixed32, fixed64, sfixed32, sfixed64, float and double fields do 
+        not depend on their value, they can be changed without serializing the message again. Only 
+        the bytes of the value are written, the rest of the data is not changed.
+
+        \param[in,out] data Pointer to the first byte of the serialized message.
+        \param[in] size The number of bytes in the serialized message.
+        \param[in] field_number The number of the field to overwrite.
+        \param[in] field The new value.
+        \return The result of find_field(), the data is only changed when no errors occurred.
     */
-    Error skip_unknown_field(::EmbeddedProto::ReadBufferInterface& buffer, 
-                             const ::EmbeddedProto::WireFormatter::WireType& wire_type) const;
+    template<class FIELD_TYPE>
+    static Error patch_field(uint8_t* data, const uint32_t size, const uint32_t field_number, 
+                             const FIELD_TYPE& field)
+    {
+      static_assert((::EmbeddedProto::WireFormatter::WireType::FIXED32 == FIELD_TYPE::WIRE_TYPE) ||
+                    (::EmbeddedProto::WireFormatter::WireType::FIXED64 == FIELD_TYPE::WIRE_TYPE), 
+                    "Only fields with a fixed width can be patched.");
+
+      uint32_t offset = 0;
+      Error return_value = find_field(data, size, field_number, FIELD_TYPE::WIRE_TYPE, offset);
+      if(Error::NO_ERRORS == return_value)
+      {
+        ::EmbeddedProto::WriteBufferFixedSize<FIELD_TYPE::MAX_SERIALIZED_SIZE> value_buffer;
+        return_value = field.serialize(value_buffer);
+        if(Error::NO_ERRORS == return_value)
+        {
+          memcpy(data + offset, value_buffer.get_data(), value_buffer.get_size());
+        }
+      }
+      return return_value;
+    }
+
+  protected:
 
-    Error skip_varint(::EmbeddedProto::ReadBufferInterface& buffer) const;
-    Error skip_fixed32(::EmbeddedProto::ReadBufferInterface& buffer) const;
-    Error skip_fixed64(::EmbeddedProto::ReadBufferInterface& buffer) const;
-    Error skip_length_delimited(::EmbeddedProto::ReadBufferInterface& buffer) const;
+    static Error skip_varint(::EmbeddedProto::ReadBufferInterface& buffer);
+    static Error skip_fixed32(::EmbeddedProto::ReadBufferInterface& buffer);
+    static Error skip_fixed64(::EmbeddedProto::ReadBufferInterface& buffer);
+    static Error skip_length_delimited(::EmbeddedProto::ReadBufferInterface& buffer);
+    static Error skip_group(::EmbeddedProto::ReadBufferInterface& buffer);
 
 };
 
@@ -47,7 +47,7 @@ namespace EmbeddedProto
 
       \see MessageInterface::serialized_size()  
   */
-  class MessageSizeCalculator : public WriteBufferInterface
+  class MessageSizeCalculator final : public WriteBufferInterface
   {
     public:
       MessageSizeCalculator() = default;
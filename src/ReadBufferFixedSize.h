@@ -42,7 +42,7 @@ namespace EmbeddedProto
       The template sets the number of bytes which fit in the buffer.
   */
   template<uint32_t BUFFER_SIZE>
-  class ReadBufferFixedSize : public ::EmbeddedProto::ReadBufferInterface
+  class ReadBufferFixedSize final : public ::EmbeddedProto::ReadBufferInterface
   {
     public:
       //! The default constructor which initializes everything at zero.
@@ -88,11 +88,11 @@ namespace EmbeddedProto
       //! \see ::EmbeddedProto::ReadBufferInterface::advance(const uint32_t N)
       bool advance(const uint32_t N) override
       {
-        const uint32_t new_read_index = read_index_ + N;
-        const bool return_value = write_index_ >= new_read_index;
+        // Compare with the remaining bytes, adding N to the index first could overflow.
+        const bool return_value = (write_index_ - read_index_) >= N;
         if(return_value)
         {
-          read_index_ = new_read_index;
+          read_index_ += N;
         }
         return return_value;
       }
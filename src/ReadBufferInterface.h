@@ -89,6 +89,21 @@ namespace EmbeddedProto
       */
       virtual bool pop(uint8_t& byte) = 0;
 
+      //! Obtain a pointer to the next bytes in the buffer without reading them.
+      /*!
+          This is only possible for buffers which hold all data in one block of memory which stays 
+          valid and unchanged for as long as messages deserialized from it are used. Other buffers 
+          return nullptr, this is the default.
+
+          \param[in] n_bytes The number of bytes required to be available in the buffer.
+          \return A pointer to the next byte or nullptr when not supported or too few bytes are left.
+      */
+      virtual const uint8_t* get_persistent_data(const uint32_t n_bytes) const 
+      { 
+        static_cast<void>(n_bytes);
+        return nullptr; 
+      }
+
   };
 
 } // End of namespace EmbeddedProto
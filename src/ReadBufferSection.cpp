@@ -77,11 +77,12 @@ namespace EmbeddedProto
 
   bool ReadBufferSection::advance(const uint32_t n_bytes)
   {
-    bool result = 0 < size_;
-    if(result) 
+    // Never advance beyond the end of the section but do report it when not all bytes were there.
+    bool result = n_bytes <= size_;
+    const uint32_t n = result ? n_bytes : size_;
+    if(0 < n) 
     {
-      uint32_t n = (n_bytes <= size_) ? n_bytes : size_;
-      result = buffer_.advance(n);
+      result = buffer_.advance(n) && result;
       size_ -= n;
     }
     return result;
@@ -93,9 +94,17 @@ namespace EmbeddedProto
     if(result)
     {
       result = buffer_.pop(byte);
-      --size_;
+      if(result)
+      {
+        --size_;
+      }
     }
     return result;
   }
 
+  const uint8_t* ReadBufferSection::get_persistent_data(const uint32_t n_bytes) const
+  {
+    return (n_bytes <= size_) ? buffer_.get_persistent_data(n_bytes) : nullptr;
+  }
+
 } // End of namespace EmbeddedProto
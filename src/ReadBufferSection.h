@@ -46,7 +46,7 @@ namespace EmbeddedProto
 
       \see ReadBufferInterface
   */
-  class ReadBufferSection : public ReadBufferInterface
+  class ReadBufferSection final : public ReadBufferInterface
   {
     public:
 
@@ -88,8 +88,8 @@ namespace EmbeddedProto
 
       //! Decrement the size by N bytes and call advance on the parent buffer.
       /*!
-        This will not do anything if size zero is reached.
-        \return True when the buffer held the n_bytes or more.
+        This will not advance beyond the end of the section.
+        \return True when the section held the n_bytes or more.
       */
       bool advance(const uint32_t n_bytes) override;
 
@@ -100,6 +100,9 @@ namespace EmbeddedProto
       */
       bool pop(uint8_t& byte) override;
 
+      //! Expose the data of the parent buffer when the section holds n_bytes or more.
+      const uint8_t* get_persistent_data(const uint32_t n_bytes) const override;
+
     private:
 
       //! A reference to the buffer containing the actual data.
@@ -0,0 +1,152 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _READ_BUFFER_VIEW_H_
+#define _READ_BUFFER_VIEW_H_
+
+#include "ReadBufferInterface.h"
+
+#include <cstdint>
+
+namespace EmbeddedProto 
+{
+
+  //! This class implements the ReadBufferInterface on top of data stored elsewhere.
+  /*!
+      The buffer does not copy the data, it reads directly from the given memory, for example a 
+      receive buffer or data in flash. The data should stay valid and unchanged for as long as the 
+      buffer and messages deserialized from it are used. This allows lazy message fields to keep a 
+      pointer to their serialized data.
+  */
+  class ReadBufferView final : public ::EmbeddedProto::ReadBufferInterface
+  {
+    public:
+      //! Explicitly delete the default constructor in favor of the one with parameters.
+      ReadBufferView() = delete;
+
+      //! Construct a buffer reading from the given data.
+      /*!
+        \param data Pointer to the first byte of the serialized data.
+        \param size The number of bytes in the data.
+      */
+      ReadBufferView(const uint8_t* data, const uint32_t size) 
+        : data_(data),
+          size_(size)
+      {
+
+      }
+
+      //! The default destructor.
+      ~ReadBufferView() override = default;
+
+      //! Returns the number of bytes not yet read.
+      uint32_t get_size() const override
+      {
+        return size_ - read_index_;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::get_max_size()
+      uint32_t get_max_size() const override
+      {
+        return size_;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::peak()
+      bool peek(uint8_t& byte) const override
+      {
+        const bool return_value = size_ > read_index_;
+        if(return_value)
+        {
+          byte = data_[read_index_];
+        }
+        return return_value;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::advance()
+      bool advance() override
+      {
+        const bool return_value = size_ > read_index_;
+        if(return_value)
+        {
+          ++read_index_;
+        }
+        return return_value;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::advance(const uint32_t N)
+      bool advance(const uint32_t N) override
+      {
+        const bool return_value = (size_ - read_index_) >= N;
+        if(return_value)
+        {
+          read_index_ += N;
+        }
+        return return_value;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::pop()
+      bool pop(uint8_t& byte) override
+      {
+        const bool return_value = size_ > read_index_;
+        if(return_value)
+        {
+          byte = data_[read_index_];
+          ++read_index_;
+        }
+        return return_value;
+      }
+
+      //! \see ::EmbeddedProto::ReadBufferInterface::get_persistent_data()
+      const uint8_t* get_persistent_data(const uint32_t n_bytes) const override
+      {
+        return ((size_ - read_index_) >= n_bytes) ? (data_ + read_index_) : nullptr;
+      }
+
+      //! Start reading from the beginning of the data again.
+      void reset()
+      {
+        read_index_ = 0;
+      }
+
+    private:
+
+      //! The data from which is read.
+      const uint8_t* data_;
+
+      //! The number of bytes in the data.
+      const uint32_t size_;
+
+      //! The number of bytes read from the data.
+      uint32_t read_index_ = 0;
+  };
+
+} // namespace EmbeddedProto
+
+#endif // End of _READ_BUFFER_VIEW_H_
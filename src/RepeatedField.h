@@ -33,6 +33,7 @@
 
 #include "Defines.h"
 #include "Fields.h"
+#include "Hash.h"
 #include "MessageInterface.h"
 #include "MessageSizeCalculator.h"
 #include "ReadBufferSection.h"
@@ -40,6 +41,7 @@
 #include "Errors.h"
 
 #include <cstdint>
+#include <algorithm>
 
 
 namespace EmbeddedProto
@@ -62,13 +64,21 @@ namespace EmbeddedProto
     static_assert(std::is_base_of<::EmbeddedProto::Field, DATA_TYPE>::value || is_specialization_of_FieldTemplate<DATA_TYPE>::value, 
                   "A Field can only be used as template paramter.");
 
-    //! Check how this field shoeld be serialized, packed or not.
-    static constexpr bool REPEATED_FIELD_IS_PACKED = 
-          !(std::is_base_of<MessageInterface, DATA_TYPE>::value
-            || std::is_base_of<internal::BaseStringBytes, DATA_TYPE>::value);
+    protected:
+
+      //! Set the number of elements in use. Only for internal usage.
+      /*!
+          The value is limited to the maximum length of the array.
+      */
+      virtual void set_length(uint32_t length) = 0;
 
     public:
 
+      //! Check how this field shoeld be serialized, packed or not.
+      static constexpr bool REPEATED_FIELD_IS_PACKED = 
+            !(std::is_base_of<MessageInterface, DATA_TYPE>::value
+              || std::is_base_of<internal::BaseStringBytes, DATA_TYPE>::value);
+
       RepeatedField() = default;
       ~RepeatedField() override = default;
 
@@ -120,6 +130,73 @@ namespace EmbeddedProto
       */
       const DATA_TYPE& operator[](uint32_t index) const { return this->get_const(index); }
 
+      //! Obtain a pointer to the first element in the array.
+      /*!
+        The elements are stored contiguously. Unlike get() accessing elements through this pointer 
+        does not check the index or change the length of the array.
+      */
+      virtual DATA_TYPE* data() = 0;
+
+      //! Obtain a constant pointer to the first element in the array.
+      virtual const DATA_TYPE* data() const = 0;
+
+      //! Iterators over the elements in use.
+      DATA_TYPE* begin() { return this->data(); }
+      DATA_TYPE* end() { return this->data() + this->get_length(); }
+      const DATA_TYPE* begin() const { return this->data(); }
+      const DATA_TYPE* end() const { return this->data() + this->get_length(); }
+
+      //! Two arrays are equal when they have the same number of elements and the elements are equal.
+      bool operator==(const RepeatedField<DATA_TYPE>& rhs) const
+      {
+        bool equal = (this->get_length() == rhs.get_length());
+        for(uint32_t i = 0; equal && (i < this->get_length()); ++i)
+        {
+          equal = (this->get_const(i) == rhs.get_const(i));
+        }
+        return equal;
+      }
+
+      bool operator!=(const RepeatedField<DATA_TYPE>& rhs) const { return !(*this == rhs); }
+
+      //! Mix the number of elements and the elements in use into the given hash.
+      uint64_t hash(const uint64_t seed) const
+      {
+        uint64_t result = Hash::value(seed, this->get_length());
+        for(const auto& element : *this)
+        {
+          result = Hash::value(result, element);
+        }
+        return result;
+      }
+
+      //! Obtain a view of the elements in use.
+      array_view<DATA_TYPE> get_view() { return {this->data(), this->get_length()}; }
+
+      //! Obtain a constant view of the elements in use.
+      array_view<const DATA_TYPE> get_view() const { return {this->data(), this->get_length()}; }
+
+      //! Obtain a view of the elements in use as an array of the underlying scalar type.
+      /*!
+        Only available for arrays of scalars and enums. A FieldTemplate only holds its value so the 
+        array of fields has the same layout as an array of values. Use this for numeric processing 
+        without going through the field interface.
+      */
+      template<class T = DATA_TYPE, typename std::enable_if<is_specialization_of_FieldTemplate<T>::value, int>::type = 0>
+      array_view<typename T::TYPE> get_raw_view() 
+      {
+        static_assert(sizeof(T) == sizeof(typename T::TYPE), "A field should only hold its value.");
+        return {reinterpret_cast<typename T::TYPE*>(this->data()), this->get_length()};
+      }
+
+      //! Obtain a constant view of the elements in use as an array of the underlying scalar type.
+      template<class T = DATA_TYPE, typename std::enable_if<is_specialization_of_FieldTemplate<T>::value, int>::type = 0>
+      array_view<const typename T::TYPE> get_raw_view() const
+      {
+        static_assert(sizeof(T) == sizeof(typename T::TYPE), "A field should only hold its value.");
+        return {reinterpret_cast<const typename T::TYPE*>(this->data()), this->get_length()};
+      }
+
       //! Set the value at the given index.
       /*!
         \param[in] index The desired index to change.
@@ -142,6 +219,14 @@ namespace EmbeddedProto
       */
       virtual Error add(const DATA_TYPE& value) = 0;
 
+      //! Append a cleared element to the end of the array and obtain a pointer to it.
+      /*!
+        Use this to construct an element in place instead of building a temporary and copying it in 
+        with add().
+        \return A pointer to the new element or nullptr when there is no space left.
+      */
+      virtual DATA_TYPE* add_new() = 0;
+
       //! Remove all data in the array and set it to the default value.
       virtual void clear() override = 0;
 
@@ -189,7 +274,7 @@ namespace EmbeddedProto
           const uint32_t size_x = this->serialized_size_unpacked(field_number);
           if(size_x <= buffer.get_available_size()) 
           {
-            return_value = serialize_unpacked(field_number, buffer);
+            return_value = serialize_unpacked(field_number, 0, this->get_length(), buffer);
           }
           else 
           {
@@ -251,9 +336,77 @@ namespace EmbeddedProto
       */
       uint32_t serialized_size_unpacked(int32_t field_number) const 
       {
-        ::EmbeddedProto::MessageSizeCalculator calcBuffer;
-        serialize_unpacked(field_number, calcBuffer);
-        return calcBuffer.get_size();
+        uint32_t size = 0;
+        for(const auto& element : *this)
+        {
+          size += element_size_unpacked(field_number, element);
+        }
+        return size;
+      }
+
+      //! The number of bytes the element at the given index takes when serialized, including its tag and size.
+      /*!
+        Only for arrays of messages, strings and bytes, these are serialized one element after the 
+        other. Together with serialize_elements() this allows parts of a large array to be 
+        serialized at the same time, each directly at its final position in one output buffer. The 
+        offset of an element is the sum of the sizes of the elements before it.
+      */
+      template<class T = DATA_TYPE, typename std::enable_if<!is_specialization_of_FieldTemplate<T>::value, int>::type = 0>
+      uint32_t element_serialized_size(const uint32_t field_number, const uint32_t index) const
+      {
+        return element_size_unpacked(field_number, this->get_const(index));
+      }
+
+      //! Serialize the elements from first up to, but not including, last.
+      /*!
+        The result is the same as the corresponding part of the output of serialize_with_id().
+      */
+      template<class T = DATA_TYPE, typename std::enable_if<!is_specialization_of_FieldTemplate<T>::value, int>::type = 0>
+      Error serialize_elements(const uint32_t field_number, const uint32_t first, const uint32_t last, 
+                               WriteBufferInterface& buffer) const
+      {
+        return serialize_unpacked(field_number, first, std::min(last, this->get_length()), buffer);
+      }
+
+
+      //! The maximum number of bytes an array of max_length elements takes when serialized with the given field number.
+      /*!
+        Packed arrays have a single tag and length. In unpacked arrays every element has its own tag 
+        and length.
+      */
+      static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number, const uint32_t max_length)
+      {
+        return REPEATED_FIELD_IS_PACKED
+               ? WireFormatter::LengthDelimitedSize(field_number, max_length * DATA_TYPE::MAX_SERIALIZED_SIZE)
+               : max_length * WireFormatter::LengthDelimitedSize(field_number, DATA_TYPE::MAX_SERIALIZED_SIZE);
+      }
+
+      //! Check the serialized data of an array without storing it, see the generated validate().
+      /*!
+        Unpacked arrays are serialized with a tag per element, this function is then called once 
+        for each element. A packed array may also be split over multiple tags. The elements found 
+        are added to n_elements, which the caller should start at zero for each message.
+
+        \param[in] buffer The data just after the tag.
+        \param[in] wire_type The wire type of the tag.
+        \param[in] depth The nesting depth of the message holding this field.
+        \param[in] max_length The maximum number of elements in the array.
+        \param[in,out] n_elements The number of elements found so far in this message.
+        \return ARRAY_FULL when more than max_length elements where found.
+      */
+      template<class BUFFER_TYPE>
+      static Error validate_check_type(BUFFER_TYPE& buffer, 
+                                       const ::EmbeddedProto::WireFormatter::WireType& wire_type,
+                                       const uint32_t depth, const uint32_t max_length, uint32_t& n_elements)
+      {
+        Error return_value = ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED == wire_type 
+                             ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = validate_elements(buffer, depth, max_length, n_elements, 
+                                           std::integral_constant<bool, REPEATED_FIELD_IS_PACKED>());
+        }
+        return return_value;
       }
 
 
@@ -304,31 +457,88 @@ namespace EmbeddedProto
 
     private:
 
+      //! Validate the elements in a packed array, all sharing a single tag and length.
+      template<class BUFFER_TYPE>
+      static Error validate_elements(BUFFER_TYPE& buffer, const uint32_t depth, const uint32_t max_length, 
+                                     uint32_t& n_elements, std::true_type /* is_packed */)
+      {
+        uint32_t size = 0;
+        Error return_value = WireFormatter::DeserializeVarint(buffer, size);
+        if(Error::NO_ERRORS == return_value)
+        {
+          ReadBufferSection section(buffer, size);
+          const WireFormatter::WireType element_wire_type = DATA_TYPE::WIRE_TYPE;
+          if(section.get_max_size() < size)
+          {
+            // The array is longer than the data left.
+            return_value = Error::END_OF_BUFFER;
+          }
+          while((Error::NO_ERRORS == return_value) && (0 < section.get_size()))
+          {
+            return_value = DATA_TYPE::validate_check_type(section, element_wire_type, depth);
+            ++n_elements;
+            if((Error::NO_ERRORS == return_value) && (max_length < n_elements))
+            {
+              return_value = Error::ARRAY_FULL;
+            }
+          }
+        }
+        return return_value;
+      }
+
+      //! Validate a single element of an unpacked array.
+      template<class BUFFER_TYPE>
+      static Error validate_elements(BUFFER_TYPE& buffer, const uint32_t depth, const uint32_t max_length, 
+                                     uint32_t& n_elements, std::false_type /* is_packed */)
+      {
+        Error return_value = DATA_TYPE::validate_check_type(buffer, 
+                                  ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED, depth);
+        ++n_elements;
+        if((Error::NO_ERRORS == return_value) && (max_length < n_elements))
+        {
+          return_value = Error::ARRAY_FULL;
+        }
+        return return_value;
+      }
+
+      // The loops below obtain the storage and length once and then access the elements directly. 
+      // This avoids a virtual call per element and allows the element functions to be inlined.
+
       Error serialize_packed(WriteBufferInterface& buffer) const
       {
         Error return_value = Error::NO_ERRORS;
-        for(uint32_t i = 0; (i < this->get_length()) && (Error::NO_ERRORS == return_value); ++i)
+        const DATA_TYPE* elements = this->data();
+        const uint32_t length = this->get_length();
+        for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == return_value); ++i)
         {
-          return_value = this->get_const(i).serialize(buffer);
+          return_value = elements[i].serialize(buffer);
         }
         return return_value;
       }
 
-      Error serialize_unpacked(uint32_t field_number, WriteBufferInterface& buffer) const
+      static uint32_t element_size_unpacked(const uint32_t field_number, const DATA_TYPE& element)
+      {
+        const uint32_t size_x = element.serialized_size();
+        return WireFormatter::TagSize(field_number) + WireFormatter::VarintSize(size_x) + size_x;
+      }
+
+      Error serialize_unpacked(uint32_t field_number, const uint32_t first, const uint32_t last, 
+                               WriteBufferInterface& buffer) const
       {
         Error return_value = Error::NO_ERRORS;
-        for(uint32_t i = 0; (i < this->get_length()) && (Error::NO_ERRORS == return_value); ++i)
+        const DATA_TYPE* elements = this->data();
+        const uint32_t tag = WireFormatter::MakeTag(field_number, 
+                                                    WireFormatter::WireType::LENGTH_DELIMITED);
+        for(uint32_t i = first; (i < last) && (Error::NO_ERRORS == return_value); ++i)
         {
-          const uint32_t size_x = this->get_const(i).serialized_size();
-          uint32_t tag = WireFormatter::MakeTag(field_number, 
-                                    WireFormatter::WireType::LENGTH_DELIMITED);
+          const uint32_t size_x = elements[i].serialized_size();
           return_value = WireFormatter::SerializeVarint(tag, buffer);
           if(Error::NO_ERRORS == return_value)
           {
             return_value = WireFormatter::SerializeVarint(size_x, buffer);
             if((Error::NO_ERRORS == return_value) && (0 < size_x)) 
             {
-              return_value = this->get_const(i).serialize(buffer);
+              return_value = elements[i].serialize(buffer);
             }
           }
         }
@@ -340,23 +550,29 @@ namespace EmbeddedProto
         uint32_t size = 0;
         Error return_value = WireFormatter::DeserializeVarint(buffer, size);
         ReadBufferSection bufferSection(buffer, size);
-        DATA_TYPE x;
-        
-        return_value = x.deserialize(bufferSection);
-        while(Error::NO_ERRORS == return_value)
+
+        // Decode each value directly into the next element of the array.
+        DATA_TYPE* elements = this->data();
+        const uint32_t max_length = this->get_max_length();
+        uint32_t length = this->get_length();
+        while((Error::NO_ERRORS == return_value) && (0 < bufferSection.get_size()))
         {
-          return_value = this->add(x);
-          if(Error::NO_ERRORS == return_value)
+          if(max_length > length)
+          {
+            elements[length].clear();
+            return_value = elements[length].deserialize(bufferSection);
+            if(Error::NO_ERRORS == return_value)
+            {
+              // Only elements which are decoded completely are added to the array.
+              ++length;
+            }
+          }
+          else
           {
-            return_value = x.deserialize(bufferSection);
+            return_value = Error::ARRAY_FULL;
           }
         }
-
-        // We expect the buffersection to be empty, in that case everything is fine..
-        if(Error::END_OF_BUFFER == return_value)
-        {
-          return_value = Error::NO_ERRORS;
-        }
+        this->set_length(length);
 
         return return_value;
       }
@@ -367,8 +583,8 @@ namespace EmbeddedProto
 
         // For repeated messages, strings or bytes
         // First allocate an element in the array.
-        const uint32_t index = this->get_length();
-        if(this->get_max_length() > index)
+        DATA_TYPE* x = this->add_new();
+        if(nullptr != x)
         {
           // For messages read the size here, with strings and byte arrays this is include in 
           // deserialize.
@@ -379,12 +595,12 @@ namespace EmbeddedProto
             if(Error::NO_ERRORS == return_value) 
             {
               ReadBufferSection bufferSection(buffer, size);
-              return_value = this->get(index).deserialize(bufferSection);
+              return_value = x->deserialize(bufferSection);
             }
           }
           else 
           {
-            return_value = this->get(index).deserialize(buffer);
+            return_value = x->deserialize(buffer);
           }
         }
         else 
@@ -38,6 +38,7 @@
 #include <cstring>
 #include <algorithm>
 #include <array>
+#include <utility>
 
 
 namespace EmbeddedProto
@@ -49,7 +50,7 @@ namespace EmbeddedProto
     class using this type of object.
   */
   template<class DATA_TYPE, uint32_t MAX_LENGTH>
-  class RepeatedFieldFixedSize : public RepeatedField<DATA_TYPE>
+  class RepeatedFieldFixedSize final : public RepeatedField<DATA_TYPE>
   { 
       static constexpr uint32_t BYTES_PER_ELEMENT = sizeof(DATA_TYPE);
 
@@ -59,10 +60,21 @@ namespace EmbeddedProto
       ~RepeatedFieldFixedSize() override = default;
 
       RepeatedFieldFixedSize(const RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>& rhs) :
-        current_length_(rhs.get_length()),
-        data_(rhs.get_data_const())
+        current_length_(rhs.get_length())
+      {
+        const auto& rhs_data = rhs.get_data_const();
+        std::copy(rhs_data.begin(), rhs_data.begin() + current_length_, data_.begin());
+      }
+
+      //! Move the elements in use of the right hand side into this object.
+      /*!
+        The storage is fixed so the elements themselves are moved. Elements which are messages will 
+        in turn move their fields.
+      */
+      RepeatedFieldFixedSize(RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>&& rhs) noexcept :
+        current_length_(rhs.current_length_)
       {
-        // Use the initializer list.
+        std::move(rhs.data_.begin(), rhs.data_.begin() + current_length_, data_.begin());
       }
 
       template<uint32_t MAX_LENGTH_RHS, typename std::enable_if<(MAX_LENGTH_RHS < MAX_LENGTH), int>::type = 0>
@@ -70,26 +82,41 @@ namespace EmbeddedProto
         current_length_(rhs.get_length())
       {
         const auto& rhs_data = rhs.get_data_const();
-        std::copy(rhs_data.begin(), rhs_data.end(), data_.begin());
+        std::copy(rhs_data.begin(), rhs_data.begin() + current_length_, data_.begin());
       }
 
       template<uint32_t MAX_LENGTH_RHS, typename std::enable_if<(MAX_LENGTH_RHS < MAX_LENGTH), int>::type = 0>
-      explicit RepeatedFieldFixedSize(const RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH_RHS>&& rhs) :
+      explicit RepeatedFieldFixedSize(RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH_RHS>&& rhs) :
         current_length_(rhs.get_length())
       {
-        const auto& rhs_data = rhs.get_data_const();
-        std::copy(rhs_data.begin(), rhs_data.end(), data_.begin());
+        auto& rhs_data = rhs.get_data();
+        std::move(rhs_data.begin(), rhs_data.begin() + current_length_, data_.begin());
       }
 
       //! Assign one repieted field to the other, but only when the length and type matches.
       RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>& operator=(const 
                                                 RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>& rhs)
       {
-        for(uint32_t i = 0; i < rhs.get_length(); ++i) 
+        if(this != &rhs)
         {
-          data_[i] = rhs.get_const(i);
+          // Only copy the elements in use. For trivially copyable elements this is a single memmove.
+          const auto& rhs_data = rhs.get_data_const();
+          std::copy(rhs_data.begin(), rhs_data.begin() + rhs.get_length(), data_.begin());
+          clear_tail(rhs.get_length());
+        }
+        
+        return *this;
+      }
+
+      //! Move the elements in use of the right hand side into this object.
+      RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>& operator=(
+                                                RepeatedFieldFixedSize<DATA_TYPE, MAX_LENGTH>&& rhs) noexcept
+      {
+        if(this != &rhs)
+        {
+          std::move(rhs.data_.begin(), rhs.data_.begin() + rhs.current_length_, data_.begin());
+          clear_tail(rhs.current_length_);
         }
-        current_length_ = rhs.get_length();
         
         return *this;
       }
@@ -136,6 +163,10 @@ namespace EmbeddedProto
         return result;
       }
 
+      DATA_TYPE* data() override { return data_.data(); }
+
+      const DATA_TYPE* data() const override { return data_.data(); }
+
       void set(uint32_t index, const DATA_TYPE& value) override 
       { 
         uint32_t limited_index = std::min(index, MAX_LENGTH-1);
@@ -181,6 +212,18 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      DATA_TYPE* add_new() override
+      {
+        DATA_TYPE* return_value = nullptr;
+        if(MAX_LENGTH > current_length_)
+        {
+          return_value = &(data_[current_length_]);
+          return_value->clear();
+          ++current_length_;
+        }
+        return return_value;
+      }
+
       void clear() override 
       {
         for(auto& d : data_)
@@ -190,11 +233,53 @@ namespace EmbeddedProto
         current_length_ = 0;
       }
 
+      //! The maximum number of bytes this array takes when serialized with the given field number.
+      /*!
+        Packed arrays have a single tag and length. In unpacked arrays every element has its own tag 
+        and length.
+      */
+      static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number)
+      {
+        return RepeatedField<DATA_TYPE>::max_serialized_size_with_id(field_number, MAX_LENGTH);
+      }
+
+      //! Check the serialized data of this array without storing it, see the generated validate().
+      /*!
+        \see RepeatedField::validate_check_type()
+      */
+      template<class BUFFER_TYPE>
+      static Error validate_check_type(BUFFER_TYPE& buffer, 
+                                       const ::EmbeddedProto::WireFormatter::WireType& wire_type,
+                                       const uint32_t depth, uint32_t& n_elements)
+      {
+        return RepeatedField<DATA_TYPE>::validate_check_type(buffer, wire_type, depth, MAX_LENGTH, n_elements);
+      }
+
       //! Return a reference to the internal data storage array.
       const std::array<DATA_TYPE, MAX_LENGTH>& get_data_const() const { return data_; }
 
+      //! Return a reference to the internal data storage array.
+      std::array<DATA_TYPE, MAX_LENGTH>& get_data() { return data_; }
+
+    protected:
+
+      void set_length(uint32_t length) override { current_length_ = std::min(length, MAX_LENGTH); }
+
     private:
 
+      //! Set the new length and clear the elements left behind from a longer previous length.
+      /*!
+        This way get_data_const() never exposes elements from before an assignment.
+      */
+      void clear_tail(const uint32_t length)
+      {
+        for(uint32_t i = length; i < current_length_; ++i)
+        {
+          data_[i].clear();
+        }
+        current_length_ = length;
+      }
+
       //! Number of item in the data array.
       uint32_t current_length_ = 0;
 
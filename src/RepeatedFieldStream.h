@@ -0,0 +1,431 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _REPEATED_FIELD_STREAM_H_
+#define _REPEATED_FIELD_STREAM_H_
+
+#include "Fields.h"
+#include "Hash.h"
+#include "MessageInterface.h"
+#include "MessageSizeCalculator.h"
+#include "ReadBufferSection.h"
+#include "RepeatedField.h"
+#include "Errors.h"
+
+#include <cstdint>
+#include <type_traits>
+
+
+namespace EmbeddedProto
+{
+
+  //! Implement this interface to provide the elements of a streamed repeated field when serializing.
+  /*!
+    The elements are obtained one at the time, they do not have to be stored. For packed arrays of 
+    variable width elements, get() is called twice for every element: once to calculate the size of 
+    the array and once to serialize it. The same index should thus give the same element.
+  */
+  template<class DATA_TYPE>
+  class RepeatedFieldSource
+  {
+    public:
+      RepeatedFieldSource() = default;
+      virtual ~RepeatedFieldSource() = default;
+
+      //! The number of elements to serialize.
+      virtual uint32_t get_length() const = 0;
+
+      //! Obtain the element at the given index.
+      /*!
+        \param[in] index The index of the element, smaller than get_length().
+        \param[out] element The element to fill, it is cleared before the call.
+        \return Any error other than NO_ERRORS stops the serialization and is returned.
+      */
+      virtual Error get(const uint32_t index, DATA_TYPE& element) const = 0;
+  };
+
+  //! Implement this interface to receive the elements of a streamed repeated field when deserializing.
+  template<class DATA_TYPE>
+  class RepeatedFieldSink
+  {
+    public:
+      RepeatedFieldSink() = default;
+      virtual ~RepeatedFieldSink() = default;
+
+      //! Called for every element directly after it has been decoded.
+      /*!
+        \param[in] element The element, it is only valid during the call.
+        \return Any error other than NO_ERRORS stops the deserialization and is returned.
+      */
+      virtual Error push(const DATA_TYPE& element) = 0;
+  };
+
+  //! A repeated field of which the elements are not stored in the message.
+  /*!
+    When serializing, the elements are obtained one by one from a RepeatedFieldSource. When 
+    deserializing, each element is passed to a RepeatedFieldSink as soon as it has been decoded. 
+    Only a single element is kept on the stack at any time so the RAM used does not depend on the 
+    number of elements. 
+
+    MAX_LENGTH is the largest number of elements accepted. It is used to calculate the maximum 
+    serialized size of the message and only limits the data, not the memory used.
+
+    Without a source nothing is serialized, without a sink the elements received are dropped.
+  */
+  template<class DATA_TYPE, uint32_t MAX_LENGTH>
+  class RepeatedFieldStream
+  {
+      //! Scalars and enums are packed, messages, strings and bytes have a tag per element.
+      static constexpr bool IS_PACKED = RepeatedField<DATA_TYPE>::REPEATED_FIELD_IS_PACKED;
+
+    public:
+
+      using SOURCE_TYPE = RepeatedFieldSource<DATA_TYPE>;
+      using SINK_TYPE = RepeatedFieldSink<DATA_TYPE>;
+
+      RepeatedFieldStream() = default;
+      ~RepeatedFieldStream() = default;
+
+      //! Set the source of the elements to serialize, the source should outlive the serialization.
+      void set_source(const SOURCE_TYPE* source) { source_ = source; }
+      const SOURCE_TYPE* get_source() const { return source_; }
+
+      //! Set the sink receiving the elements when deserializing.
+      void set_sink(SINK_TYPE* sink) { sink_ = sink; }
+      SINK_TYPE* get_sink() const { return sink_; }
+
+      //! The number of elements provided by the source.
+      uint32_t get_length() const { return (nullptr != source_) ? source_->get_length() : 0; }
+
+      //! The number of elements received since the field was last cleared.
+      uint32_t get_n_received() const { return n_received_; }
+
+      //! The maximum number of elements accepted.
+      static constexpr uint32_t get_max_length() { return MAX_LENGTH; }
+
+      //! Reset the number of elements received, the source and sink are kept.
+      void clear() { n_received_ = 0; }
+
+      //! The maximum number of bytes this array takes when serialized with the given field number.
+      static constexpr uint32_t max_serialized_size_with_id(const uint32_t field_number)
+      {
+        return RepeatedField<DATA_TYPE>::max_serialized_size_with_id(field_number, MAX_LENGTH);
+      }
+
+      //! Serialize all elements of the source.
+      /*!
+        \return ARRAY_FULL when the source holds more than MAX_LENGTH elements, the first error 
+                returned by the source or the result of writing to the buffer.
+      */
+      Error serialize_with_id(uint32_t field_number, WriteBufferInterface& buffer, const bool optional) const
+      {
+        const uint32_t length = get_length();
+        Error return_value = (MAX_LENGTH >= length) ? Error::NO_ERRORS : Error::ARRAY_FULL;
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = serialize_elements(field_number, length, buffer, optional, 
+                                            std::integral_constant<bool, IS_PACKED>());
+        }
+        return return_value;
+      }
+
+      //! Decode the elements and pass them on to the sink.
+      Error deserialize_check_type(ReadBufferInterface& buffer, const WireFormatter::WireType& wire_type)
+      {
+        Error return_value = WireFormatter::WireType::LENGTH_DELIMITED == wire_type 
+                             ? Error::NO_ERRORS : Error::INVALID_WIRETYPE;
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = deserialize_elements(buffer, std::integral_constant<bool, IS_PACKED>());
+        }
+        return return_value;
+      }
+
+      //! \see RepeatedField::validate_check_type()
+      template<class BUFFER_TYPE>
+      static Error validate_check_type(BUFFER_TYPE& buffer, const WireFormatter::WireType& wire_type,
+                                       const uint32_t depth, uint32_t& n_elements)
+      {
+        return RepeatedField<DATA_TYPE>::validate_check_type(buffer, wire_type, depth, MAX_LENGTH, n_elements);
+      }
+
+      //! Compare the elements of both sources, the sinks are not compared.
+      bool operator==(const RepeatedFieldStream<DATA_TYPE, MAX_LENGTH>& rhs) const
+      {
+        const uint32_t length = get_length();
+        bool equal = (length == rhs.get_length());
+        DATA_TYPE lhs_element;
+        DATA_TYPE rhs_element;
+        for(uint32_t i = 0; equal && (i < length); ++i)
+        {
+          equal = (Error::NO_ERRORS == get_element(i, lhs_element)) 
+                  && (Error::NO_ERRORS == rhs.get_element(i, rhs_element))
+                  && (lhs_element == rhs_element);
+        }
+        return equal;
+      }
+
+      bool operator!=(const RepeatedFieldStream<DATA_TYPE, MAX_LENGTH>& rhs) const { return !(*this == rhs); }
+
+      //! Mix the number of elements and the elements of the source into the given hash.
+      uint64_t hash(const uint64_t seed) const
+      {
+        const uint32_t length = get_length();
+        uint64_t result = Hash::value(seed, length);
+        DATA_TYPE element;
+        for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == get_element(i, element)); ++i)
+        {
+          result = Hash::value(result, element);
+        }
+        return result;
+      }
+
+#ifdef MSG_TO_STRING
+
+      ::EmbeddedProto::string_view to_string(::EmbeddedProto::string_view& str, const uint32_t indent_level, char const* name, const bool first_field) const
+      {
+        ::EmbeddedProto::string_view left_chars = str;
+        int32_t n_chars_used = 0;
+
+        if(!first_field)
+        {
+          // Add a comma behind the previous field.
+          n_chars_used = snprintf(left_chars.data, left_chars.size, ",\n");
+          if(0 < n_chars_used)
+          {
+            // Update the character pointer and characters left in the array.
+            left_chars.data += n_chars_used;
+            left_chars.size -= n_chars_used;
+          }
+        }
+
+        n_chars_used = snprintf(left_chars.data, left_chars.size, "%*s\"%s\": [\n", indent_level, " ", name );
+        
+        if(0 < n_chars_used) 
+        {
+          left_chars.data += n_chars_used;
+          left_chars.size -= n_chars_used;
+        }
+
+        // Only the elements of the source are printed, received elements are not stored.
+        const uint32_t length = get_length();
+        DATA_TYPE element;
+        for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == get_element(i, element)); ++i)
+        {
+          left_chars = element.to_string(left_chars, n_chars_used, nullptr, (0 == i));
+        }
+
+        n_chars_used = snprintf(left_chars.data, left_chars.size, "\n%*s]", n_chars_used - 2, " ");
+        
+        if(0 < n_chars_used)
+        {
+          left_chars.data += n_chars_used;
+          left_chars.size -= n_chars_used;
+        }
+
+        return left_chars;
+      }
+
+#endif // End of MSG_TO_STRING
+
+    private:
+
+      //! Obtain a cleared element from the source.
+      Error get_element(const uint32_t index, DATA_TYPE& element) const
+      {
+        element.clear();
+        return source_->get(index, element);
+      }
+
+      //! Calculate the number of bytes of the packed elements.
+      /*!
+        For fixed width elements this follows from the number of elements, otherwise all elements 
+        are obtained once to calculate the size.
+      */
+      Error serialized_size_packed(const uint32_t length, uint32_t& size) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        const WireFormatter::WireType wire_type = DATA_TYPE::WIRE_TYPE;
+        if(WireFormatter::WireType::VARINT != wire_type)
+        {
+          size = length * DATA_TYPE::MAX_SERIALIZED_SIZE;
+        }
+        else
+        {
+          MessageSizeCalculator calcBuffer;
+          DATA_TYPE element;
+          for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == return_value); ++i)
+          {
+            return_value = get_element(i, element);
+            if(Error::NO_ERRORS == return_value)
+            {
+              return_value = element.serialize(calcBuffer);
+            }
+          }
+          size = calcBuffer.get_size();
+        }
+        return return_value;
+      }
+
+      Error serialize_elements(const uint32_t field_number, const uint32_t length, WriteBufferInterface& buffer, 
+                               const bool optional, std::true_type /* is_packed */) const
+      {
+        Error return_value = Error::NO_ERRORS;
+        if((0 < length) || optional)
+        {
+          uint32_t size_x = 0;
+          return_value = serialized_size_packed(length, size_x);
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::SerializeVarint(
+                              WireFormatter::MakeTag(field_number, WireFormatter::WireType::LENGTH_DELIMITED), buffer);
+          }
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::SerializeVarint(size_x, buffer);
+          }
+
+          DATA_TYPE element;
+          for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == return_value); ++i)
+          {
+            return_value = get_element(i, element);
+            if(Error::NO_ERRORS == return_value)
+            {
+              return_value = element.serialize(buffer);
+            }
+          }
+        }
+        return return_value;
+      }
+
+      Error serialize_elements(const uint32_t field_number, const uint32_t length, WriteBufferInterface& buffer, 
+                               const bool optional, std::false_type /* is_packed */) const
+      {
+        static_cast<void>(optional);
+        Error return_value = Error::NO_ERRORS;
+        const uint32_t tag = WireFormatter::MakeTag(field_number, WireFormatter::WireType::LENGTH_DELIMITED);
+        DATA_TYPE element;
+        for(uint32_t i = 0; (i < length) && (Error::NO_ERRORS == return_value); ++i)
+        {
+          return_value = get_element(i, element);
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = WireFormatter::SerializeVarint(tag, buffer);
+          }
+          if(Error::NO_ERRORS == return_value)
+          {
+            const uint32_t size_x = element.serialized_size();
+            return_value = WireFormatter::SerializeVarint(size_x, buffer);
+            if((Error::NO_ERRORS == return_value) && (0 < size_x))
+            {
+              return_value = element.serialize(buffer);
+            }
+          }
+        }
+        return return_value;
+      }
+
+      Error deserialize_elements(ReadBufferInterface& buffer, std::true_type /* is_packed */)
+      {
+        uint32_t size = 0;
+        Error return_value = WireFormatter::DeserializeVarint(buffer, size);
+        ReadBufferSection bufferSection(buffer, size);
+        DATA_TYPE element;
+        while((Error::NO_ERRORS == return_value) && (0 < bufferSection.get_size()))
+        {
+          element.clear();
+          return_value = element.deserialize(bufferSection);
+          if(Error::NO_ERRORS == return_value)
+          {
+            return_value = receive(element);
+          }
+        }
+        return return_value;
+      }
+
+      Error deserialize_elements(ReadBufferInterface& buffer, std::false_type /* is_packed */)
+      {
+        Error return_value = Error::NO_ERRORS;
+        DATA_TYPE element;
+        // For messages read the size here, with strings and byte arrays this is include in deserialize.
+        if(std::is_base_of<MessageInterface, DATA_TYPE>::value)
+        {
+          uint32_t size = 0;
+          return_value = WireFormatter::DeserializeVarint(buffer, size);
+          if(Error::NO_ERRORS == return_value) 
+          {
+            ReadBufferSection bufferSection(buffer, size);
+            return_value = element.deserialize(bufferSection);
+          }
+        }
+        else
+        {
+          return_value = element.deserialize(buffer);
+        }
+
+        if(Error::NO_ERRORS == return_value)
+        {
+          return_value = receive(element);
+        }
+        return return_value;
+      }
+
+      //! Count the element and pass it on to the sink.
+      Error receive(const DATA_TYPE& element)
+      {
+        Error return_value = Error::NO_ERRORS;
+        if(MAX_LENGTH > n_received_)
+        {
+          ++n_received_;
+          if(nullptr != sink_)
+          {
+            return_value = sink_->push(element);
+          }
+        }
+        else
+        {
+          return_value = Error::ARRAY_FULL;
+        }
+        return return_value;
+      }
+
+      //! The elements to serialize.
+      const SOURCE_TYPE* source_ = nullptr;
+
+      //! The receiver of deserialized elements.
+      SINK_TYPE* sink_ = nullptr;
+
+      //! The number of elements received since the last clear().
+      uint32_t n_received_ = 0;
+  };
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _REPEATED_FIELD_STREAM_H_
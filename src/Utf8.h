@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _UTF8_H_
+#define _UTF8_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace EmbeddedProto 
+{
+
+  //! Check if the given bytes are valid UTF-8.
+  /*!
+    Overlong encodings, surrogates and code points above U+10FFFF are rejected. Blocks of eight 
+    ASCII characters are checked at once, the other characters one by one.
+
+    \param data Pointer to the first byte.
+    \param length The number of bytes.
+    \return True when the data is valid UTF-8.
+  */
+  inline bool is_valid_utf8(const uint8_t* data, const uint32_t length)
+  {
+    constexpr uint64_t ASCII_MASK = 0x8080808080808080ULL;
+    bool valid = true;
+    uint32_t i = 0;
+    while(valid && (i < length))
+    {
+      uint64_t block = ASCII_MASK;
+      if((length - i) >= sizeof(block))
+      {
+        memcpy(&block, data + i, sizeof(block));
+      }
+
+      const uint8_t byte = data[i];
+      if(0 == (block & ASCII_MASK))
+      {
+        i += sizeof(block);
+      }
+      else if(0x80 > byte)
+      {
+        ++i;
+      }
+      else
+      {
+        // The number of continuation bytes and the range allowed for the first one.
+        uint32_t n_continuation = 0;
+        uint8_t lower = 0x80;
+        uint8_t upper = 0xBF;
+        if((0xC2 <= byte) && (0xDF >= byte))
+        {
+          n_continuation = 1;
+        }
+        else if((0xE0 <= byte) && (0xEF >= byte))
+        {
+          n_continuation = 2;
+          lower = (0xE0 == byte) ? 0xA0 : lower;
+          upper = (0xED == byte) ? 0x9F : upper;
+        }
+        else if((0xF0 <= byte) && (0xF4 >= byte))
+        {
+          n_continuation = 3;
+          lower = (0xF0 == byte) ? 0x90 : lower;
+          upper = (0xF4 == byte) ? 0x8F : upper;
+        }
+        else
+        {
+          valid = false;
+        }
+
+        valid = valid && ((length - i - 1) >= n_continuation);
+        for(uint32_t j = 1; valid && (j <= n_continuation); ++j)
+        {
+          const uint8_t continuation = data[i + j];
+          valid = (lower <= continuation) && (upper >= continuation);
+          lower = 0x80;
+          upper = 0xBF;
+        }
+        i += 1 + n_continuation;
+      }
+    }
+    return valid;
+  }
+
+} // End of namespace EmbeddedProto
+
+#endif // End of _UTF8_H_
@@ -46,6 +46,11 @@ namespace EmbeddedProto
 {
 
   //! This class combines functions to serialize and deserialize messages.
+  /*!
+    The functions taking a buffer are templated on the buffer type. Passing a concrete buffer, like 
+    WriteBufferFixedSize, allows the compiler to inline the push and pop calls. Passing a 
+    WriteBufferInterface or ReadBufferInterface reference uses the virtual functions.
+  */
   class WireFormatter 
   {
 
@@ -132,14 +137,41 @@ namespace EmbeddedProto
         return ((field_number << 3) | static_cast<uint32_t>(type));
       }
 
+      //! Calculate the number of bytes a value takes when serialized as a varint.
+      /*!
+        \param[in] value The value to be serialized.
+        \return The number of bytes, between one and ten.
+      */
+      static constexpr uint32_t VarintSize(const uint64_t value)
+      {
+        return (VARINT_MSB_BYTE > value) ? 1 : 1 + VarintSize(value >> VARINT_SHIFT_N_BITS);
+      }
+
+      //! Calculate the number of bytes the tag of a field takes when serialized.
+      static constexpr uint32_t TagSize(const uint32_t field_number)
+      {
+        return VarintSize(MakeTag(field_number, WireType::VARINT));
+      }
+
+      //! Calculate the maximum number of bytes of a length delimited field.
+      /*!
+        \param[in] field_number The number of the field.
+        \param[in] max_length The maximum number of bytes of data in the field.
+        \return The number of bytes for the tag, the length and the data together.
+      */
+      static constexpr uint32_t LengthDelimitedSize(const uint32_t field_number, const uint32_t max_length)
+      {
+        return TagSize(field_number) + VarintSize(max_length) + max_length;
+      }
+
       /**
          @brief Serialize fields, without tags the given buffer.
          @{
       **/
 
       //! Serialize an unsigned fixed length field without the tag.
-      template<class UINT_TYPE>
-      static Error SerializeFixedNoTag(const UINT_TYPE value, WriteBufferInterface& buffer)
+      template<class UINT_TYPE, class BUFFER_TYPE>
+      static Error SerializeFixedNoTag(const UINT_TYPE value, BUFFER_TYPE& buffer)
       {
         static_assert(std::is_same<UINT_TYPE, uint32_t>::value || 
                       std::is_same<UINT_TYPE, uint64_t>::value, "Wrong type passed to SerializeFixedNoTag.");
@@ -158,8 +190,8 @@ namespace EmbeddedProto
       }
 
       //! Serialize a signed fixed length field without the tag.
-      template<class INT_TYPE>
-      static Error SerialzieSFixedNoTag(const INT_TYPE value, WriteBufferInterface& buffer)
+      template<class INT_TYPE, class BUFFER_TYPE>
+      static Error SerialzieSFixedNoTag(const INT_TYPE value, BUFFER_TYPE& buffer)
       {
         static_assert(std::is_same<INT_TYPE, int32_t>::value || 
                       std::is_same<INT_TYPE, int64_t>::value, "Wrong type passed to SerialzieSFixedNoTag.");
@@ -170,7 +202,8 @@ namespace EmbeddedProto
       }
 
       //! Serialize a 32bit real value without tag.
-      static Error SerialzieFloatNoTag(const float value, WriteBufferInterface& buffer)
+      template<class BUFFER_TYPE>
+      static Error SerialzieFloatNoTag(const float value, BUFFER_TYPE& buffer)
       {
         // Cast the type to void and to a 32 fixed number
         const auto* pVoid = static_cast<const void*>(&value);
@@ -179,7 +212,8 @@ namespace EmbeddedProto
       }
 
       //! Serialize a 64bit real value without tag.
-      static Error SerialzieDoubleNoTag(const double value, WriteBufferInterface& buffer)
+      template<class BUFFER_TYPE>
+      static Error SerialzieDoubleNoTag(const double value, BUFFER_TYPE& buffer)
       {
         // Cast the type to void and to a 64 fixed number
         const auto* pVoid = static_cast<const void*>(&value);
@@ -193,9 +227,9 @@ namespace EmbeddedProto
          @brief Serialize fields, including tags to the given buffer.
          @{
       **/
-      template<class INT_TYPE>
+      template<class INT_TYPE, class BUFFER_TYPE>
       static Error SerializeInt(const uint32_t field_number, const INT_TYPE value, 
-                                WriteBufferInterface& buffer)
+                                BUFFER_TYPE& buffer)
       {        
         using UINT_TYPE = typename std::make_unsigned<INT_TYPE>::type;
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::VARINT), buffer);
@@ -206,9 +240,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
-      template<class UINT_TYPE>
+      template<class UINT_TYPE, class BUFFER_TYPE>
       static Error SerializeUInt(const uint32_t field_number, const UINT_TYPE value, 
-                                WriteBufferInterface& buffer)
+                                BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::VARINT), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -218,9 +252,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
-      template<class INT_TYPE>
+      template<class INT_TYPE, class BUFFER_TYPE>
       static Error SerializeSInt(const uint32_t field_number, const INT_TYPE value, 
-                                 WriteBufferInterface& buffer)
+                                 BUFFER_TYPE& buffer)
       {
          Error return_value = SerializeVarint(MakeTag(field_number, WireType::VARINT), buffer);
          if(Error::NO_ERRORS == return_value)
@@ -230,8 +264,9 @@ namespace EmbeddedProto
         return return_value;
       }
       
+      template<class BUFFER_TYPE>
       static Error SerializeFixed(const uint32_t field_number, const uint32_t value, 
-                                  WriteBufferInterface& buffer)
+                                  BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED32), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -241,8 +276,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeFixed(const uint32_t field_number, const uint64_t value, 
-                                  WriteBufferInterface& buffer)
+                                  BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED64), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -252,8 +288,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeSFixed(const uint32_t field_number, const int32_t value, 
-                                   WriteBufferInterface& buffer)
+                                   BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED32), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -263,8 +300,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeSFixed(const uint32_t field_number, const int64_t value, 
-                                   WriteBufferInterface& buffer)
+                                   BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED64), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -274,8 +312,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeFloat(const uint32_t field_number, const float value, 
-                                  WriteBufferInterface& buffer)
+                                  BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED32), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -285,8 +324,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeDouble(const uint32_t field_number, const double value, 
-                                   WriteBufferInterface& buffer)
+                                   BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::FIXED64), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -296,8 +336,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeBool(const uint32_t field_number, const bool value, 
-                                 WriteBufferInterface& buffer)
+                                 BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::VARINT), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -308,8 +349,9 @@ namespace EmbeddedProto
         return return_value;
       }
 
+      template<class BUFFER_TYPE>
       static Error SerializeEnum(const uint32_t field_number, const uint32_t value, 
-                                 WriteBufferInterface& buffer)
+                                 BUFFER_TYPE& buffer)
       {
         Error return_value = SerializeVarint(MakeTag(field_number, WireType::VARINT), buffer);
         if(Error::NO_ERRORS == return_value)
@@ -333,7 +375,8 @@ namespace EmbeddedProto
           \param[out] id This parameter returns the next field id.
           \return A value from the EmbeddedProto::Error enum indicating if the process succeeded.
       */
-      static Error DeserializeTag(ReadBufferInterface& buffer, WireType& type, uint32_t& id) 
+      template<class BUFFER_TYPE>
+      static Error DeserializeTag(BUFFER_TYPE& buffer, WireType& type, uint32_t& id) 
       {
         uint32_t temp_value;
         // Read the next varint considered to be a tag.
@@ -356,8 +399,8 @@ namespace EmbeddedProto
         return return_value;
       }
 
-      template<class UINT_TYPE>
-      static Error DeserializeUInt(ReadBufferInterface& buffer, UINT_TYPE& value) 
+      template<class UINT_TYPE, class BUFFER_TYPE>
+      static Error DeserializeUInt(BUFFER_TYPE& buffer, UINT_TYPE& value) 
       {
         static_assert(std::is_same<UINT_TYPE, uint32_t>::value || 
                       std::is_same<UINT_TYPE, uint64_t>::value, "Wrong type passed to DeserializeUInt.");
@@ -365,8 +408,8 @@ namespace EmbeddedProto
         return DeserializeVarint(buffer, value);
       }
 
-      template<class INT_TYPE>
-      static Error DeserializeInt(ReadBufferInterface& buffer, INT_TYPE& value) 
+      template<class INT_TYPE, class BUFFER_TYPE>
+      static Error DeserializeInt(BUFFER_TYPE& buffer, INT_TYPE& value) 
       {
         static_assert(std::is_same<INT_TYPE, int32_t>::value || 
                       std::is_same<INT_TYPE, int64_t>::value, "Wrong type passed to DeserializeInt.");
@@ -382,8 +425,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      template<class INT_TYPE>
-      static Error DeserializeSInt(ReadBufferInterface& buffer, INT_TYPE& value) 
+      template<class INT_TYPE, class BUFFER_TYPE>
+      static Error DeserializeSInt(BUFFER_TYPE& buffer, INT_TYPE& value) 
       {
         static_assert(std::is_same<INT_TYPE, int32_t>::value || 
                       std::is_same<INT_TYPE, int64_t>::value, "Wrong type passed to DeserializeSInt.");
@@ -401,8 +444,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      template<class TYPE>
-      static Error DeserializeFixed(ReadBufferInterface& buffer, TYPE& value) 
+      template<class TYPE, class BUFFER_TYPE>
+      static Error DeserializeFixed(BUFFER_TYPE& buffer, TYPE& value) 
       {
         static_assert(std::is_same<TYPE, uint32_t>::value || 
                       std::is_same<TYPE, uint64_t>::value, "Wrong type passed to DeserializeFixed.");
@@ -436,8 +479,8 @@ namespace EmbeddedProto
         return return_value;
       }
 
-      template<class STYPE>
-      static Error DeserializeSFixed(ReadBufferInterface& buffer, STYPE& value) 
+      template<class STYPE, class BUFFER_TYPE>
+      static Error DeserializeSFixed(BUFFER_TYPE& buffer, STYPE& value) 
       {
         static_assert(std::is_same<STYPE, int32_t>::value || 
                       std::is_same<STYPE, int64_t>::value, "Wrong type passed to DeserializeSFixed.");
@@ -453,7 +496,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      static Error DeserializeFloat(ReadBufferInterface& buffer, float& value) 
+      template<class BUFFER_TYPE>
+      static Error DeserializeFloat(BUFFER_TYPE& buffer, float& value) 
       {
         uint32_t temp_value = 0;
         Error result = DeserializeFixed(buffer, temp_value);
@@ -467,7 +511,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      static Error DeserializeDouble(ReadBufferInterface& buffer, double& value) 
+      template<class BUFFER_TYPE>
+      static Error DeserializeDouble(BUFFER_TYPE& buffer, double& value) 
       {
         uint64_t temp_value = 0;
         Error result = DeserializeFixed(buffer, temp_value);
@@ -481,7 +526,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      static Error DeserializeBool(ReadBufferInterface& buffer, bool& value) 
+      template<class BUFFER_TYPE>
+      static Error DeserializeBool(BUFFER_TYPE& buffer, bool& value) 
       {
         uint8_t byte;
         Error result = Error::NO_ERRORS;
@@ -496,8 +542,8 @@ namespace EmbeddedProto
         return result;
       }
 
-      template<class ENUM_TYPE>
-      static Error DeserializeEnum(ReadBufferInterface& buffer, ENUM_TYPE& value) 
+      template<class ENUM_TYPE, class BUFFER_TYPE>
+      static Error DeserializeEnum(BUFFER_TYPE& buffer, ENUM_TYPE& value) 
       {
         static_assert(std::is_enum<ENUM_TYPE>::value, "No enum given to DeserializeEnum parameter value.");
         uint64_t temp_value;
@@ -519,8 +565,8 @@ namespace EmbeddedProto
         \param[in] buffer A reference to a message buffer object in which to store the variable.
         \return A value from the Error enum, NO_ERROR in case everything is fine.
       */
-      template<class UINT_TYPE>
-      static Error SerializeVarint(UINT_TYPE value, WriteBufferInterface& buffer) 
+      template<class UINT_TYPE, class BUFFER_TYPE>
+      static Error SerializeVarint(UINT_TYPE value, BUFFER_TYPE& buffer) 
       {
         static_assert(std::is_same<UINT_TYPE, uint32_t>::value || 
                       std::is_same<UINT_TYPE, uint64_t>::value, 
@@ -544,8 +590,8 @@ namespace EmbeddedProto
         \param[out] value The variable in which the varint is returned.
         \return A value from the Error enum, NO_ERROR in case everything is fine.
       */
-      template<class UINT_TYPE>
-      static Error DeserializeVarint(ReadBufferInterface& buffer, UINT_TYPE& value) 
+      template<class UINT_TYPE, class BUFFER_TYPE>
+      static Error DeserializeVarint(BUFFER_TYPE& buffer, UINT_TYPE& value) 
       {
         static_assert(std::is_same<UINT_TYPE, uint32_t>::value || 
                       std::is_same<UINT_TYPE, uint64_t>::value, 
@@ -33,12 +33,13 @@
 
 #include "WriteBufferInterface.h"
 #include <array>
+#include <cstring>
 
 namespace EmbeddedProto 
 {
 
   template<uint32_t BUFFER_SIZE>
-  class WriteBufferFixedSize : public ::EmbeddedProto::WriteBufferInterface
+  class WriteBufferFixedSize final : public ::EmbeddedProto::WriteBufferInterface
   {  
     public:
       WriteBufferFixedSize() = default;
@@ -85,7 +86,7 @@ namespace EmbeddedProto
       //! \see ::EmbeddedProto::WriteBufferInterface::push()
       bool push(const uint8_t* bytes, const uint32_t length) override
       {
-        bool return_value = BUFFER_SIZE > (write_index_ + length);
+        bool return_value = BUFFER_SIZE >= (write_index_ + length);
         if(return_value)
         {
           memcpy(data_.data() + write_index_, bytes, length);
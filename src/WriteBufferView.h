@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#ifndef _WRITE_BUFFER_VIEW_H_
+#define _WRITE_BUFFER_VIEW_H_
+
+#include "WriteBufferInterface.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace EmbeddedProto 
+{
+
+  //! This class implements the WriteBufferInterface on top of memory provided by the user.
+  /*!
+      The data is written directly into the given memory, for example a transmit buffer or a part of 
+      a larger buffer. Different parts of one array can be written at the same time through 
+      different views.
+  */
+  class WriteBufferView final : public ::EmbeddedProto::WriteBufferInterface
+  {
+    public:
+      //! Explicitly delete the default constructor in favor of the one with parameters.
+      WriteBufferView() = delete;
+
+      //! Construct a buffer writing into the given memory.
+      /*!
+        \param data Pointer to the first byte of the memory.
+        \param max_size The number of bytes available in the memory.
+      */
+      WriteBufferView(uint8_t* data, const uint32_t max_size) 
+        : data_(data),
+          max_size_(max_size)
+      {
+
+      }
+
+      //! The default destructor.
+      ~WriteBufferView() override = default;
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::clear()
+      void clear() override
+      {
+        write_index_ = 0;
+      }
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::get_size()
+      uint32_t get_size() const override
+      {
+        return write_index_;
+      }
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::get_max_size()
+      uint32_t get_max_size() const override
+      {
+        return max_size_;
+      }
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::get_available_size()
+      uint32_t get_available_size() const override
+      {
+        return max_size_ - write_index_;
+      }
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::push()
+      bool push(const uint8_t byte) override
+      {
+        const bool return_value = max_size_ > write_index_;
+        if(return_value)
+        {
+          data_[write_index_] = byte;
+          ++write_index_;
+        }
+        return return_value;
+      }
+
+      //! \see ::EmbeddedProto::WriteBufferInterface::push()
+      bool push(const uint8_t* bytes, const uint32_t length) override
+      {
+        const bool return_value = (max_size_ - write_index_) >= length;
+        if(return_value)
+        {
+          memcpy(data_ + write_index_, bytes, length);
+          write_index_ += length;
+        }
+        return return_value;
+      }
+
+      //! Return a pointer to the memory written to.
+      uint8_t* get_data()
+      {
+        return data_;
+      }
+
+    private:
+
+      //! The memory in which is written.
+      uint8_t* data_;
+
+      //! The number of bytes available in the memory.
+      const uint32_t max_size_;
+
+      //! The number of bytes written.
+      uint32_t write_index_ = 0;
+  };
+
+} // namespace EmbeddedProto
+
+#endif // End of _WRITE_BUFFER_VIEW_H_
@@ -156,5 +156,15 @@ namespace test_EmbeddedAMS_ReadBufferFixedSize
     EXPECT_TRUE(buffer.advance(2));
     EXPECT_FALSE(buffer.advance(2));
 
+    // A large number of bytes should not wrap the read index around.
+    buffer.clear();
+    EXPECT_TRUE(buffer.push(0));
+    EXPECT_TRUE(buffer.advance());
+    EXPECT_FALSE(buffer.advance(0xFFFFFFFF));
+    EXPECT_TRUE(buffer.push(1));
+    uint8_t byte = 0;
+    EXPECT_TRUE(buffer.pop(byte));
+    EXPECT_EQ(1, byte);
+
   }
 } // End of namespace test_EmbeddedAMS_ReadBufferFixedSize
@@ -32,6 +32,11 @@
 
 #include <Fields.h>
 #include <RepeatedFieldFixedSize.h>
+#include <ReadBufferFixedSize.h>
+
+#include <iterator>
+#include <numeric>
+#include <type_traits>
 
 namespace test_EmbeddedAMS_RepeatedFieldFixedSize
 {
@@ -98,6 +103,27 @@ TEST(RepeatedFieldFixedSize, add_data)
   EXPECT_EQ(EmbeddedProto::Error::ARRAY_FULL, result);
 }
 
+TEST(RepeatedFieldFixedSize, add_new) 
+{  
+  static constexpr uint32_t LENGTH = 2;
+  EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, LENGTH> x;
+
+  // Leave a stale value behind the end of the array.
+  x.set_data(std::array<::EmbeddedProto::uint32, LENGTH>{{5, 6}}.data(), LENGTH);
+  x.set_data(std::array<::EmbeddedProto::uint32, 1>{{7}}.data(), 1);
+
+  ::EmbeddedProto::uint32* element = x.add_new();
+  ASSERT_NE(nullptr, element);
+  EXPECT_EQ(0U, element->get());
+  *element = 8;
+  EXPECT_EQ(2U, x.get_length());
+  EXPECT_EQ(8U, x.get_const(1));
+
+  // The array is full.
+  EXPECT_EQ(nullptr, x.add_new());
+  EXPECT_EQ(LENGTH, x.get_length());
+}
+
 TEST(RepeatedFieldFixedSize, get) 
 {  
   static constexpr uint32_t LENGTH = 3;
@@ -166,6 +192,96 @@ TEST(RepeatedFieldFixedSize, set_element)
   EXPECT_EQ(3U, x.get_const(2));
 }
 
+TEST(RepeatedFieldFixedSize, iterate) 
+{
+  static constexpr uint32_t LENGTH = 4;
+  EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, LENGTH> x;
+  x.add(1);
+  x.add(2);
+  x.add(3);
+
+  uint32_t sum = 0;
+  for(const auto& v : x)
+  {
+    sum += v;
+  }
+  EXPECT_EQ(6U, sum);
+  EXPECT_EQ(3, std::distance(x.begin(), x.end()));
+  EXPECT_EQ(x.data(), x.begin());
+
+  const auto view = x.get_view();
+  EXPECT_EQ(3U, view.size);
+  EXPECT_EQ(x.data(), view.data);
+
+  // Access the values as plain integers.
+  const auto raw = x.get_raw_view();
+  EXPECT_TRUE((std::is_same<uint32_t*, decltype(raw.data)>::value));
+  EXPECT_EQ(3U, raw.size);
+  EXPECT_EQ(6U, std::accumulate(raw.begin(), raw.end(), 0U));
+
+  for(auto& v : x.get_raw_view())
+  {
+    v *= 2;
+  }
+  EXPECT_EQ(6U, x.get_const(2));
+
+  // Iteration does not change the length.
+  EXPECT_EQ(3U, x.get_length());
+}
+
+TEST(RepeatedFieldFixedSize, deserialize_packed) 
+{
+  // Length delimited, three varints of which the last takes two bytes.
+  const std::array<uint8_t, 5> bytes = {{0x04, 0x01, 0x02, 0x80, 0x01}};
+  ::EmbeddedProto::ReadBufferFixedSize<8> buffer;
+  for(const auto b : bytes)
+  {
+    buffer.push(b);
+  }
+
+  EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, 4> x;
+  x.add(7);
+  EXPECT_EQ(EmbeddedProto::Error::NO_ERRORS, x.deserialize(buffer));
+  EXPECT_EQ(4U, x.get_length());
+  EXPECT_EQ(7U, x.get_const(0));
+  EXPECT_EQ(1U, x.get_const(1));
+  EXPECT_EQ(2U, x.get_const(2));
+  EXPECT_EQ(128U, x.get_const(3));
+}
+
+TEST(RepeatedFieldFixedSize, deserialize_packed_array_full) 
+{
+  const std::array<uint8_t, 4> bytes = {{0x03, 0x01, 0x02, 0x03}};
+  ::EmbeddedProto::ReadBufferFixedSize<8> buffer;
+  for(const auto b : bytes)
+  {
+    buffer.push(b);
+  }
+
+  EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, 2> x;
+  EXPECT_EQ(EmbeddedProto::Error::ARRAY_FULL, x.deserialize(buffer));
+  EXPECT_EQ(2U, x.get_length());
+  EXPECT_EQ(1U, x.get_const(0));
+  EXPECT_EQ(2U, x.get_const(1));
+}
+
+TEST(RepeatedFieldFixedSize, deserialize_packed_incomplete_element) 
+{
+  // The last varint is not finished within the length of the field.
+  const std::array<uint8_t, 4> bytes = {{0x03, 0x01, 0x02, 0x80}};
+  ::EmbeddedProto::ReadBufferFixedSize<8> buffer;
+  for(const auto b : bytes)
+  {
+    buffer.push(b);
+  }
+
+  EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, 4> x;
+  EXPECT_EQ(EmbeddedProto::Error::END_OF_BUFFER, x.deserialize(buffer));
+  EXPECT_EQ(2U, x.get_length());
+  EXPECT_EQ(1U, x.get_const(0));
+  EXPECT_EQ(2U, x.get_const(1));
+}
+
 TEST(RepeatedFieldFixedSize, clear) 
 {
   static constexpr uint32_t LENGTH = 3;
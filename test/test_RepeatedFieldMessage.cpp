@@ -33,10 +33,13 @@
 #include <WireFormatter.h>
 #include <ReadBufferMock.h>
 #include <WriteBufferMock.h>
+#include <WriteBufferFixedSize.h>
+#include <WriteBufferView.h>
 
 #include <cstdint>    
 #include <limits>
 #include <array>
+#include <thread>
 
 // EAMS message definitions
 #include <repeated_fields.h>
@@ -604,6 +607,48 @@ TEST(RepeatedFieldMessage, deserialize_repeated_enum)
   EXPECT_EQ(SomeEnum::SE_C, enum_msg.get_enum_values()[2]);
 }
 
+TEST(RepeatedFieldMessage, serialize_elements_in_parallel)
+{
+  constexpr uint32_t N_ELEMENTS = 64;
+  repeated_message<N_ELEMENTS> msg;
+  for(uint32_t i = 0; i < N_ELEMENTS; ++i)
+  {
+    repeated_nested_message rnm;
+    // Vary the size of the elements, some are empty.
+    rnm.set_u(i * i * i);
+    rnm.set_v((0 == (i % 3)) ? 0 : i);
+    msg.add_b(rnm);
+  }
+
+  const auto& b = msg.get_b();
+  const uint32_t field_number = static_cast<uint32_t>(repeated_message<N_ELEMENTS>::FieldNumber::B);
+
+  ::EmbeddedProto::WriteBufferFixedSize<1024> expected;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, b.serialize_with_id(field_number, expected, false));
+
+  // The offset of each element is the sum of the sizes before it.
+  std::array<uint32_t, N_ELEMENTS + 1> offsets = {0};
+  for(uint32_t i = 0; i < N_ELEMENTS; ++i)
+  {
+    offsets[i + 1] = offsets[i] + b.element_serialized_size(field_number, i);
+  }
+  ASSERT_EQ(expected.get_size(), offsets[N_ELEMENTS]);
+
+  // Serialize each half directly into its position.
+  std::array<uint8_t, 1024> result = {0};
+  constexpr uint32_t HALF = N_ELEMENTS / 2;
+  ::EmbeddedProto::WriteBufferView first(result.data(), offsets[HALF]);
+  ::EmbeddedProto::WriteBufferView second(result.data() + offsets[HALF], offsets[N_ELEMENTS] - offsets[HALF]);
+  ::EmbeddedProto::Error first_result = ::EmbeddedProto::Error::BUFFER_FULL;
+  std::thread worker([&]() { first_result = b.serialize_elements(field_number, 0, HALF, first); });
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, b.serialize_elements(field_number, HALF, N_ELEMENTS, second));
+  worker.join();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, first_result);
+
+  EXPECT_EQ(0, memcmp(expected.get_data(), result.data(), expected.get_size()));
+  EXPECT_EQ(0U, second.get_available_size());
+}
+
 #ifdef MSG_TO_STRING
 
 TEST(RepeatedFieldMessage, to_string)
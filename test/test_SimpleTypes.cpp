@@ -33,6 +33,8 @@
 #include <WireFormatter.h>
 #include <ReadBufferMock.h>
 #include <WriteBufferMock.h>
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
 
 #include <cstdint>    
 #include <limits>
@@ -542,6 +544,91 @@ TEST(SimpleTypes, deserialize_fault_overlong_varint)
   EXPECT_EQ(::EmbeddedProto::Error::OVERLONG_VARINT, msg.deserialize(buffer));
 }
 
+TEST(SimpleTypes, serialize_deserialize_concrete_buffer)
+{
+  ::Test_Simple_Types msg;
+  msg.set_a_int32(-1);
+  msg.set_a_uint64(300);
+  msg.set_a_bool(true);
+  msg.set_a_double(1.0);
+  msg.set_a_float(2.0F);
+  msg.set_a_nested_enum(::Test_Simple_Types::Nested_Enum::NE_C);
+
+  // The templated serialize function is used with the concrete buffer type.
+  ::EmbeddedProto::WriteBufferFixedSize<128> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  // The result should be the same as when using the virtual interface.
+  ::EmbeddedProto::WriteBufferFixedSize<128> buffer_interface;
+  ::EmbeddedProto::WriteBufferInterface& interface = buffer_interface;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(interface));
+  ASSERT_EQ(buffer_interface.get_size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(buffer_interface.get_data(), buffer.get_data(), buffer.get_size()));
+
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  for(uint32_t i = 0; i < buffer.get_size(); ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+
+  ::Test_Simple_Types result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer));
+  EXPECT_EQ(-1, result.get_a_int32());
+  EXPECT_EQ(300U, result.get_a_uint64());
+  EXPECT_TRUE(result.get_a_bool());
+  EXPECT_EQ(1.0, result.get_a_double());
+  EXPECT_EQ(2.0F, result.get_a_float());
+  EXPECT_EQ(::Test_Simple_Types::Nested_Enum::NE_C, result.get_a_nested_enum());
+}
+
+TEST(SimpleTypes, patch_fixed_width)
+{
+  Test_Simple_Types msg;
+  msg.set_a_int32(1);
+  msg.set_a_fixed32(5);
+  msg.set_a_double(1.5);
+  msg.set_a_sfixed64(-2);
+  msg.set_a_nested_enum(Test_Simple_Types::Nested_Enum::NE_B);
+
+  ::EmbeddedProto::WriteBufferFixedSize<128> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  const uint32_t size = buffer.get_size();
+
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, Test_Simple_Types::patch_a_fixed32(buffer.get_data(), size, 0x12345678));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, Test_Simple_Types::patch_a_double(buffer.get_data(), size, 2.5));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, Test_Simple_Types::patch_a_sfixed64(buffer.get_data(), size, -3));
+
+  // Fields which are not in the data can not be patched.
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_FIELD_ID, Test_Simple_Types::patch_a_float(buffer.get_data(), size, 1.0F));
+
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  for(uint32_t i = 0; i < size; ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+  Test_Simple_Types result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer));
+  EXPECT_EQ(1, result.get_a_int32());
+  EXPECT_EQ(0x12345678U, result.get_a_fixed32());
+  EXPECT_EQ(2.5, result.get_a_double());
+  EXPECT_EQ(-3, result.get_a_sfixed64());
+  EXPECT_EQ(0.0F, result.get_a_float());
+  EXPECT_EQ(Test_Simple_Types::Nested_Enum::NE_B, result.get_a_nested_enum());
+}
+
+TEST(SimpleTypes, patch_wrong_wire_type)
+{
+  // Field 12 serialized as a varint instead of fixed32.
+  uint8_t data[] = {0x60, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, Test_Simple_Types::patch_a_fixed32(data, sizeof(data), 2));
+  EXPECT_EQ(0x60, data[0]);
+  EXPECT_EQ(0x01, data[1]);
+
+  // The value is cut off.
+  uint8_t truncated[] = {0x65, 0x01, 0x02};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, Test_Simple_Types::patch_a_fixed32(truncated, sizeof(truncated), 2));
+}
+
 TEST(SimpleTypes, field_number_to_name)
 {
   EXPECT_TRUE(0 == strcmp(::Test_Simple_Types::field_number_to_name(::Test_Simple_Types::FieldNumber::A_INT32),
@@ -85,6 +85,19 @@ namespace test_EmbeddedAMS_WriteBufferFixedSize
     EXPECT_EQ(1, buffer.get_available_size());
   }
 
+  TEST(WriteBufferFixedSize, push_c_array_exact) 
+  {
+    constexpr uint32_t BUFFER_SIZE = 3;
+    EmbeddedProto::WriteBufferFixedSize<BUFFER_SIZE> buffer;
+
+    uint8_t data[BUFFER_SIZE] = {0, 1, 2};
+
+    // Filling the buffer completely is allowed.
+    EXPECT_TRUE(buffer.push(data, BUFFER_SIZE));
+    EXPECT_EQ(0, buffer.get_available_size());
+    EXPECT_FALSE(buffer.push(data, 1));
+  }
+
   TEST(WriteBufferFixedSize, clear) 
   {
     constexpr uint32_t BUFFER_SIZE = 3;
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <CachedSerializer.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <string.h>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace test_EmbeddedAMS_CachedSerializer
+{
+
+using MsgB = ::demo::space::message_b<3>;
+
+static void expect_same(const MsgB& msg, ::EmbeddedProto::WriteBufferFixedSize<64>& cached)
+{
+  ::EmbeddedProto::WriteBufferFixedSize<64> expected;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(expected));
+  ASSERT_EQ(expected.get_size(), cached.get_size());
+  EXPECT_EQ(0, memcmp(expected.get_data(), cached.get_data(), expected.get_size()));
+}
+
+TEST(CachedSerializer, serialize)
+{
+  ::EmbeddedProto::CachedSerializer<MsgB> cached;
+  cached.mutable_message().set_u(1.0);
+  cached.mutable_message().set_v(5);
+  EXPECT_FALSE(cached.is_cached());
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_TRUE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+  EXPECT_EQ(buffer.get_size(), cached.serialized_size());
+
+  // The second time the stored bytes are used.
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_TRUE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+}
+
+TEST(CachedSerializer, invalidate_nested)
+{
+  ::EmbeddedProto::CachedSerializer<MsgB> cached;
+  cached.mutable_message().set_v(5);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_TRUE(cached.is_cached());
+
+  // Changing a nested message or a repeated field through the mutable accessors drops the bytes.
+  cached.mutable_message().mutable_nested_a().add_x(3);
+  EXPECT_FALSE(cached.is_cached());
+
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  expect_same(cached.get(), buffer);
+  EXPECT_EQ(3, cached.get().get_nested_a().get_x()[0]);
+
+  MsgB other;
+  other.set_u(2.0);
+  cached.set(other);
+  EXPECT_FALSE(cached.is_cached());
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  expect_same(other, buffer);
+}
+
+TEST(CachedSerializer, small_capacity)
+{
+  // The message does not fit in the cache, it is serialized directly.
+  ::EmbeddedProto::CachedSerializer<MsgB, 4> cached;
+  cached.mutable_message().set_u(1.0);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_FALSE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_FALSE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+
+  // After a change which makes the message fit it is stored again.
+  {
+    auto msg = cached.modify();
+    msg->clear_u();
+    msg->set_v(1);
+  }
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_TRUE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+}
+
+TEST(CachedSerializer, modify)
+{
+  ::EmbeddedProto::CachedSerializer<MsgB> cached;
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  {
+    auto msg = cached.modify();
+    msg->set_v(5);
+
+    // Nothing is stored while the message can be changed.
+    EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+    EXPECT_FALSE(cached.is_cached());
+    expect_same(cached.get(), buffer);
+
+    msg->mutable_nested_a().set_z(2);
+    buffer.clear();
+    EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+    expect_same(cached.get(), buffer);
+  }
+
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  EXPECT_TRUE(cached.is_cached());
+  expect_same(cached.get(), buffer);
+  EXPECT_EQ(2, cached.get().get_nested_a().get_z());
+
+  // The stored bytes are dropped again when the mutator goes out of scope.
+  {
+    auto msg = cached.modify();
+    EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+    (*msg).mutable_nested_a().set_z(3);
+  }
+  EXPECT_FALSE(cached.is_cached());
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, cached.serialize(buffer));
+  expect_same(cached.get(), buffer);
+  EXPECT_EQ(3, cached.get().get_nested_a().get_z());
+}
+
+TEST(CachedSerializer, buffer_full)
+{
+  ::EmbeddedProto::CachedSerializer<MsgB> cached;
+  cached.mutable_message().set_u(1.0);
+
+  ::EmbeddedProto::WriteBufferFixedSize<4> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::BUFFER_FULL, cached.serialize(buffer));
+}
+
+} // End of namespace test_EmbeddedAMS_CachedSerializer
@@ -0,0 +1,198 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WireFormatter.h>
+#include <ReadBufferFixedSize.h>
+#include <WriteBufferFixedSize.h>
+
+#include <type_traits>
+#include <cstring>
+
+// EAMS message definitions
+#include <compact_layout.h>
+
+namespace test_EmbeddedAMS_CompactLayout
+{
+
+TEST(CompactLayout, size)
+{
+  // Both messages have the same fields, the compact one orders them by alignment and packs the booleans in bits.
+  EXPECT_LT(sizeof(Compact::CompactLayout), sizeof(Compact::DefaultLayout));
+}
+
+TEST(CompactLayout, enum_underlying_type)
+{
+  EXPECT_TRUE((std::is_same<uint32_t, std::underlying_type<Compact::DefaultLayout::State>::type>::value));
+  EXPECT_TRUE((std::is_same<uint32_t, std::underlying_type<Compact::CompactLayout::State>::type>::value));
+  EXPECT_TRUE((std::is_same<int32_t, std::underlying_type<Compact::CompactMixed::Offset>::type>::value));
+}
+
+TEST(CompactLayout, alignment)
+{
+  EXPECT_EQ(64U, alignof(Compact::CacheAligned));
+  EXPECT_EQ(0U, sizeof(Compact::CacheAligned) % 64U);
+}
+
+TEST(CompactLayout, set_get_clear)
+{
+  Compact::CompactLayout msg;
+
+  EXPECT_FALSE(msg.get_flag_a());
+  EXPECT_FALSE(msg.get_flag_b());
+  EXPECT_FALSE(msg.has_flag_opt());
+
+  msg.set_flag_a(true);
+  msg.set_flag_c(true);
+  EXPECT_TRUE(msg.get_flag_a());
+  EXPECT_FALSE(msg.get_flag_b());
+  EXPECT_TRUE(msg.flag_c());
+
+  // An optional boolean set to false is still present.
+  msg.set_flag_opt(false);
+  EXPECT_TRUE(msg.has_flag_opt());
+  EXPECT_FALSE(msg.get_flag_opt());
+  msg.set_flag_opt(true);
+  EXPECT_TRUE(msg.get_flag_opt());
+
+  msg.set_flag_a(false);
+  EXPECT_FALSE(msg.get_flag_a());
+  EXPECT_TRUE(msg.get_flag_c());
+
+  msg.clear_flag_opt();
+  EXPECT_FALSE(msg.has_flag_opt());
+  EXPECT_FALSE(msg.get_flag_opt());
+
+  msg.set_value_opt(3);
+  msg.clear();
+  EXPECT_FALSE(msg.get_flag_c());
+  EXPECT_FALSE(msg.has_value_opt());
+
+  Compact::CompactMixed mixed;
+  mixed.mutable_nested().set_enabled(true);
+  mixed.set_last(true);
+  EXPECT_TRUE(mixed.get_nested().get_enabled());
+
+  Compact::CompactMixed copy(mixed);
+  EXPECT_TRUE(copy.get_nested().get_enabled());
+  EXPECT_TRUE(copy.get_last());
+}
+
+TEST(CompactLayout, same_wire_format)
+{
+  Compact::DefaultLayout default_msg;
+  Compact::CompactLayout compact_msg;
+
+  default_msg.set_flag_a(true);
+  default_msg.set_value_d(1.5);
+  default_msg.set_value_i(-2);
+  default_msg.set_flag_opt(false);
+  default_msg.set_state(Compact::DefaultLayout::State::ERROR);
+  default_msg.set_flag_c(true);
+
+  compact_msg.set_flag_a(true);
+  compact_msg.set_value_d(1.5);
+  compact_msg.set_value_i(-2);
+  compact_msg.set_flag_opt(false);
+  compact_msg.set_state(Compact::CompactLayout::State::ERROR);
+  compact_msg.set_flag_c(true);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> default_buffer;
+  ::EmbeddedProto::WriteBufferFixedSize<64> compact_buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, default_msg.serialize(default_buffer));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, compact_msg.serialize(compact_buffer));
+
+  ASSERT_EQ(default_buffer.get_size(), compact_buffer.get_size());
+  for(uint32_t i = 0; i < default_buffer.get_size(); ++i)
+  {
+    EXPECT_EQ(default_buffer.get_data()[i], compact_buffer.get_data()[i]);
+  }
+
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  for(uint32_t i = 0; i < compact_buffer.get_size(); ++i)
+  {
+    read_buffer.push(compact_buffer.get_data()[i]);
+  }
+
+  Compact::CompactLayout result;
+  result.set_flag_b(true);
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer));
+  EXPECT_TRUE(result.get_flag_a());
+  EXPECT_TRUE(result.get_flag_b());
+  EXPECT_TRUE(result.get_flag_c());
+  EXPECT_TRUE(result.has_flag_opt());
+  EXPECT_FALSE(result.get_flag_opt());
+  EXPECT_FALSE(result.has_value_opt());
+  EXPECT_EQ(1.5, result.get_value_d());
+  EXPECT_EQ(-2, result.get_value_i());
+  EXPECT_EQ(Compact::CompactLayout::State::ERROR, result.get_state());
+}
+
+TEST(CompactLayout, negative_enum)
+{
+  Compact::CompactMixed msg;
+  msg.set_offset(Compact::CompactMixed::Offset::MINUS_ONE);
+
+  ::EmbeddedProto::WriteBufferFixedSize<32> write_buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(write_buffer));
+
+  ::EmbeddedProto::ReadBufferFixedSize<32> read_buffer;
+  for(uint32_t i = 0; i < write_buffer.get_size(); ++i)
+  {
+    read_buffer.push(write_buffer.get_data()[i]);
+  }
+
+  Compact::CompactMixed result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer));
+  EXPECT_EQ(Compact::CompactMixed::Offset::MINUS_ONE, result.get_offset());
+}
+
+TEST(CompactLayout, unknown_enum_value)
+{
+  // A value which is not defined in the proto file is kept as it is.
+  const uint8_t data[] = {0x30, 0xAC, 0x02};
+  ::EmbeddedProto::ReadBufferFixedSize<32> read_buffer;
+  for(const uint8_t byte : data)
+  {
+    read_buffer.push(byte);
+  }
+
+  Compact::CompactLayout msg;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.deserialize(read_buffer));
+  EXPECT_EQ(300U, static_cast<uint32_t>(msg.get_state()));
+
+  ::EmbeddedProto::WriteBufferFixedSize<32> write_buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(write_buffer));
+  ASSERT_EQ(sizeof(data), write_buffer.get_size());
+  EXPECT_EQ(0, memcmp(data, write_buffer.get_data(), sizeof(data)));
+}
+
+} // End of namespace test_EmbeddedAMS_CompactLayout
@@ -0,0 +1,272 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+#include <string.h>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace test_EmbeddedAMS_FieldMask
+{
+
+constexpr uint32_t SIZE_MSG_A = 3;
+
+using MsgA = ::demo::space::message_a<SIZE_MSG_A>;
+using MsgB = ::demo::space::message_b<SIZE_MSG_A>;
+
+static void fill(MsgB& msg)
+{
+  msg.set_u(1.0);
+  msg.set_v(1);
+  msg.mutable_nested_a().add_x(1);
+  msg.mutable_nested_a().set_y(1.0F);
+  msg.mutable_nested_a().set_z(1);
+}
+
+static void fill_read_buffer(const MsgB& msg, ::EmbeddedProto::ReadBufferFixedSize<64>& read_buffer)
+{
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  for(uint32_t i = 0; i < buffer.get_size(); ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+}
+
+TEST(FieldMask, set_and_clear)
+{
+  MsgB::FieldMask mask;
+  EXPECT_TRUE(mask.none());
+
+  mask.set(MsgB::FieldNumber::V);
+  EXPECT_TRUE(mask.is_set(MsgB::FieldNumber::V));
+  EXPECT_FALSE(mask.is_set(MsgB::FieldNumber::U));
+  EXPECT_FALSE(mask.none());
+
+  mask.set(MsgB::FieldNumber::V, false);
+  EXPECT_FALSE(mask.is_set(MsgB::FieldNumber::V));
+  EXPECT_TRUE(mask.none());
+
+  // Not a field, should be ignored.
+  mask.set(MsgB::FieldNumber::NOT_SET);
+  EXPECT_TRUE(mask.none());
+  EXPECT_FALSE(mask.is_set(MsgB::FieldNumber::NOT_SET));
+
+  mask.set_all();
+  EXPECT_TRUE(mask.is_set(MsgB::FieldNumber::U));
+  EXPECT_TRUE(mask.is_set(MsgB::FieldNumber::NESTED_A));
+  EXPECT_TRUE(mask.is_set(MsgB::FieldNumber::V));
+}
+
+TEST(FieldMask, serialize_empty_mask)
+{
+  MsgB msg;
+  fill(msg);
+
+  MsgB::FieldMask mask;
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer, mask));
+  EXPECT_EQ(0U, buffer.get_size());
+  EXPECT_EQ(0U, msg.serialized_size(mask));
+}
+
+TEST(FieldMask, serialize_all)
+{
+  MsgB msg;
+  fill(msg);
+
+  MsgB::FieldMask mask;
+  mask.set_all();
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer_mask;
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer_full;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer_mask, mask));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer_full));
+  ASSERT_EQ(buffer_full.get_size(), buffer_mask.get_size());
+  EXPECT_EQ(0, memcmp(buffer_full.get_data(), buffer_mask.get_data(), buffer_full.get_size()));
+  EXPECT_EQ(msg.serialized_size(), msg.serialized_size(mask));
+}
+
+TEST(FieldMask, serialize_subset)
+{
+  MsgB msg;
+  fill(msg);
+
+  MsgB::FieldMask mask;
+  mask.set(MsgB::FieldNumber::U);
+  mask.set(MsgB::FieldNumber::V);
+
+  const std::array<uint8_t, 11> expected = {0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, // u
+                                            0x18, 0x01}; // v
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer, mask));
+  ASSERT_EQ(expected.size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.data(), buffer.get_data(), expected.size()));
+  EXPECT_EQ(expected.size(), msg.serialized_size(mask));
+}
+
+TEST(FieldMask, serialize_nested_mask)
+{
+  MsgB msg;
+  fill(msg);
+
+  MsgB::FieldMask mask;
+  mask.set(MsgB::FieldNumber::NESTED_A);
+  mask.mutable_nested_a().set(MsgA::FieldNumber::Y);
+
+  const std::array<uint8_t, 7> expected = {0x12, 0x05, // nested_a
+                                           0x15, 0x00, 0x00, 0x80, 0x3F}; // y
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer, mask));
+  ASSERT_EQ(expected.size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.data(), buffer.get_data(), expected.size()));
+
+  // The nested mask is not used when the nested field itself is not selected.
+  mask.set(MsgB::FieldNumber::NESTED_A, false);
+  EXPECT_EQ(0U, msg.serialized_size(mask));
+}
+
+TEST(FieldMask, serialize_nested_mask_default)
+{
+  // Only the nested message is set, its selected field has the default value.
+  MsgB msg;
+  msg.set_v(1);
+
+  MsgB::FieldMask mask;
+  mask.set_all();
+  mask.mutable_nested_a().set(MsgA::FieldNumber::Y);
+
+  // Just like serialize() the empty nested message is left out.
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer_mask;
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer_full;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer_mask, mask));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer_full));
+  ASSERT_EQ(buffer_full.get_size(), buffer_mask.get_size());
+  EXPECT_EQ(0, memcmp(buffer_full.get_data(), buffer_mask.get_data(), buffer_full.get_size()));
+  EXPECT_EQ(buffer_full.get_size(), msg.serialized_size(mask));
+}
+
+TEST(FieldMask, deserialize_subset)
+{
+  MsgB msg;
+  fill(msg);
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  fill_read_buffer(msg, read_buffer);
+
+  MsgB::FieldMask mask;
+  mask.set(MsgB::FieldNumber::U);
+  mask.set(MsgB::FieldNumber::V);
+
+  MsgB result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer, mask));
+  EXPECT_EQ(1.0, result.get_u());
+  EXPECT_EQ(1, result.get_v());
+  EXPECT_EQ(0U, result.get_nested_a().get_x().get_length());
+  EXPECT_EQ(0.0F, result.get_nested_a().get_y());
+  EXPECT_EQ(0, result.get_nested_a().get_z());
+  uint8_t byte = 0;
+  EXPECT_FALSE(read_buffer.peek(byte));
+}
+
+TEST(FieldMask, deserialize_stop_early)
+{
+  MsgB msg;
+  fill(msg);
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  fill_read_buffer(msg, read_buffer);
+
+  // Field u is the first in the buffer, the rest should not be read.
+  MsgB::FieldMask mask;
+  mask.set(MsgB::FieldNumber::U);
+
+  MsgB result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer, mask));
+  EXPECT_EQ(1.0, result.get_u());
+  EXPECT_EQ(0, result.get_v());
+  // The next byte is the tag of nested_a.
+  uint8_t byte = 0;
+  EXPECT_TRUE(read_buffer.peek(byte));
+  EXPECT_EQ(0x12, byte);
+}
+
+TEST(FieldMask, deserialize_empty_mask)
+{
+  MsgB msg;
+  fill(msg);
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  fill_read_buffer(msg, read_buffer);
+
+  // Nothing is selected so everything is skipped.
+  MsgB::FieldMask mask;
+  MsgB result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer, mask));
+  EXPECT_EQ(0.0, result.get_u());
+  EXPECT_EQ(0, result.get_v());
+  EXPECT_EQ(0.0F, result.get_nested_a().get_y());
+  uint8_t byte = 0;
+  EXPECT_FALSE(read_buffer.peek(byte));
+}
+
+TEST(FieldMask, deserialize_nested_mask)
+{
+  MsgB msg;
+  fill(msg);
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  fill_read_buffer(msg, read_buffer);
+
+  MsgB::FieldMask mask;
+  mask.set(MsgB::FieldNumber::NESTED_A);
+  mask.set(MsgB::FieldNumber::V);
+  mask.mutable_nested_a().set(MsgA::FieldNumber::X);
+  mask.mutable_nested_a().set(MsgA::FieldNumber::Y);
+
+  MsgB result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer, mask));
+  EXPECT_EQ(0.0, result.get_u());
+  ASSERT_EQ(1U, result.get_nested_a().get_x().get_length());
+  EXPECT_EQ(1, result.get_nested_a().x(0));
+  EXPECT_EQ(1.0F, result.get_nested_a().get_y());
+  EXPECT_EQ(0, result.get_nested_a().get_z());
+  // The parent continues after the nested message.
+  EXPECT_EQ(1, result.get_v());
+  uint8_t byte = 0;
+  EXPECT_FALSE(read_buffer.peek(byte));
+}
+
+} // End of namespace test_EmbeddedAMS_FieldMask
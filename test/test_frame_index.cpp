@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <MessageBatch.h>
+#include <FrameIndex.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+#include <thread>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace test_EmbeddedAMS_FrameIndex
+{
+
+using MsgB = ::demo::space::message_b<3>;
+
+constexpr uint32_t N_MESSAGES = 8;
+
+class FrameIndexTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+      for(uint32_t i = 0; i < N_MESSAGES; ++i)
+      {
+        messages[i].set_v(static_cast<int32_t>(i));
+        if(0 == (i % 2))
+        {
+          messages[i].mutable_nested_a().add_x(static_cast<int32_t>(i));
+        }
+      }
+      uint32_t n_serialized = 0;
+      ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+                ::EmbeddedProto::serialize_batch(messages.data(), N_MESSAGES, buffer, n_serialized));
+    }
+
+    std::array<MsgB, N_MESSAGES> messages;
+    ::EmbeddedProto::WriteBufferFixedSize<256> buffer;
+};
+
+TEST_F(FrameIndexTest, build)
+{
+  ::EmbeddedProto::FrameIndex<N_MESSAGES> index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  ASSERT_EQ(N_MESSAGES, index.get_n_frames());
+  EXPECT_EQ(buffer.get_size(), index.get_n_bytes());
+
+  EXPECT_EQ(1U, index.get_frame(0).offset);
+  EXPECT_EQ(messages[0].serialized_size(), index.get_frame(0).size);
+  EXPECT_EQ(index.get_frame(0).size + 2, index.get_frame(1).offset);
+
+  MsgB msg;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.deserialize(3, msg));
+  EXPECT_TRUE(messages[3] == msg);
+  EXPECT_EQ(::EmbeddedProto::Error::INDEX_OUT_OF_BOUND, index.deserialize(N_MESSAGES, msg));
+}
+
+TEST_F(FrameIndexTest, in_chunks)
+{
+  // Index the stream in parts of three frames.
+  ::EmbeddedProto::FrameIndex<3> index;
+  uint32_t offset = 0;
+  uint32_t n_decoded = 0;
+  ::EmbeddedProto::Error result = ::EmbeddedProto::Error::ARRAY_FULL;
+  while(::EmbeddedProto::Error::ARRAY_FULL == result)
+  {
+    result = index.build(buffer.get_data() + offset, buffer.get_size() - offset);
+    offset += index.get_n_bytes();
+
+    MsgB msg;
+    EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+              index.decode(0, index.get_n_frames(), msg, [&](const uint32_t, const MsgB& m)
+              {
+                EXPECT_TRUE(messages[n_decoded] == m);
+                ++n_decoded;
+              }));
+  }
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result);
+  EXPECT_EQ(N_MESSAGES, n_decoded);
+}
+
+TEST_F(FrameIndexTest, truncated)
+{
+  ::EmbeddedProto::FrameIndex<N_MESSAGES> index;
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, index.build(buffer.get_data(), buffer.get_size() - 1));
+  EXPECT_EQ(N_MESSAGES - 1, index.get_n_frames());
+}
+
+TEST_F(FrameIndexTest, parallel)
+{
+  ::EmbeddedProto::FrameIndex<N_MESSAGES> index;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+
+  // Each thread decodes half of the frames in its own message object, the results are kept in order.
+  std::array<MsgB, N_MESSAGES> result;
+  auto store = [&result](const uint32_t i, const MsgB& m) { result[i] = m; };
+  std::array<::EmbeddedProto::Error, 2> errors;
+  std::thread worker([&]() 
+  { 
+    MsgB msg;
+    errors[0] = index.decode(0, N_MESSAGES / 2, msg, store);
+  });
+  MsgB msg;
+  errors[1] = index.decode(N_MESSAGES / 2, N_MESSAGES, msg, store);
+  worker.join();
+
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, errors[0]);
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, errors[1]);
+  for(uint32_t i = 0; i < N_MESSAGES; ++i)
+  {
+    EXPECT_TRUE(messages[i] == result[i]);
+  }
+}
+
+} // End of namespace test_EmbeddedAMS_FrameIndex
@@ -0,0 +1,217 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+#include <string.h>
+
+// EAMS message definitions
+#include <lazy_fields.h>
+
+namespace test_EmbeddedAMS_LazyFields
+{
+
+static void fill(::Lazy::Config& msg)
+{
+  msg.set_id(1);
+  msg.mutable_settings().set_gain(5);
+  msg.mutable_settings().add_thresholds(10);
+  msg.mutable_settings().add_thresholds(20);
+  msg.mutable_backup().set_gain(6);
+  msg.mutable_eager().set_gain(7);
+}
+
+TEST(LazyFields, decode_on_access)
+{
+  ::Lazy::Config msg;
+  fill(msg);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  // id: 0x08 0x01, settings: 0x12 <size> 0x08 <gain>
+  std::array<uint8_t, 64> data;
+  memcpy(data.data(), buffer.get_data(), buffer.get_size());
+  ::EmbeddedProto::ReadBufferView view(data.data(), buffer.get_size());
+
+  ::Lazy::Config result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(view));
+  EXPECT_EQ(1U, result.get_id());
+  EXPECT_EQ(7, result.get_eager().get_gain());
+  EXPECT_TRUE(result.has_backup());
+
+  // The nested message has not been decoded yet, changing the data is visible on first access.
+  ASSERT_EQ(0x05, data[5]);
+  data[5] = 0x09;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.decode_settings());
+  EXPECT_EQ(9, result.get_settings().get_gain());
+  ASSERT_EQ(2U, result.get_settings().get_thresholds().get_length());
+  EXPECT_EQ(20U, result.get_settings().thresholds(1));
+  EXPECT_EQ(6, result.get_backup().get_gain());
+
+  // Once decoded the data is no longer read.
+  data[5] = 0x05;
+  EXPECT_EQ(9, result.get_settings().get_gain());
+}
+
+TEST(LazyFields, serialize_unchanged)
+{
+  ::Lazy::Config msg;
+  fill(msg);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  ::EmbeddedProto::ReadBufferView view(buffer.get_data(), buffer.get_size());
+
+  ::Lazy::Config result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(view));
+  EXPECT_EQ(5, result.get_settings().get_gain());
+
+  // The stored bytes are written again.
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer_out;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.serialize(buffer_out));
+  ASSERT_EQ(buffer.get_size(), buffer_out.get_size());
+  EXPECT_EQ(0, memcmp(buffer.get_data(), buffer_out.get_data(), buffer.get_size()));
+  EXPECT_EQ(buffer.get_size(), result.serialized_size());
+
+  // After a change the message itself is serialized.
+  result.mutable_settings().set_gain(3);
+  buffer_out.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.serialize(buffer_out));
+  ASSERT_EQ(buffer.get_size(), buffer_out.get_size());
+  EXPECT_EQ(0x03, buffer_out.get_data()[5]);
+
+  result.clear_settings();
+  EXPECT_EQ(0, result.get_settings().get_gain());
+  EXPECT_EQ(0U, result.get_settings().get_thresholds().get_length());
+}
+
+TEST(LazyFields, fixed_size_buffer)
+{
+  ::Lazy::Config msg;
+  fill(msg);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  // This buffer does not keep its data, the nested message is decoded directly.
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  for(uint32_t i = 0; i < buffer.get_size(); ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+
+  ::Lazy::Config result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(read_buffer));
+  read_buffer.clear();
+  EXPECT_EQ(5, result.get_settings().get_gain());
+  EXPECT_EQ(6, result.get_backup().get_gain());
+  EXPECT_EQ(7, result.get_eager().get_gain());
+}
+
+TEST(LazyFields, decode_error)
+{
+  // The settings only hold a tag without a value.
+  const std::array<uint8_t, 5> data = {0x08, 0x01, 0x12, 0x01, 0x08};
+  ::EmbeddedProto::ReadBufferView view(data.data(), data.size());
+
+  ::Lazy::Config result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(view));
+  EXPECT_EQ(1U, result.get_id());
+  EXPECT_NE(::EmbeddedProto::Error::NO_ERRORS, result.decode_settings());
+  EXPECT_EQ(0, result.get_settings().get_gain());
+
+  // The error is kept after the first attempt to decode.
+  ::EmbeddedProto::Error error = ::EmbeddedProto::Error::NO_ERRORS;
+  EXPECT_EQ(0, result.get_settings(error).get_gain());
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, error);
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, result.decode_settings());
+
+  // Until the field is cleared.
+  result.clear_settings();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.decode_settings());
+}
+
+TEST(LazyFields, copy_pending)
+{
+  ::Lazy::Named msg;
+  msg.mutable_name() = "abc";
+  msg.mutable_settings().set_gain(5);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  // name: 0x0A 0x03 'a' 'b' 'c', settings: 0x12 0x02 0x08 <gain>
+  std::array<uint8_t, 64> data;
+  memcpy(data.data(), buffer.get_data(), buffer.get_size());
+  ::EmbeddedProto::ReadBufferView view(data.data(), buffer.get_size());
+
+  ::Lazy::Named result;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, result.deserialize(view));
+
+  // Copies hold the bytes which are not decoded yet, they are not decoded while copying.
+  ::Lazy::Named copy(result);
+  ::Lazy::Named assigned;
+  assigned = result;
+  ::Lazy::Named moved(std::move(assigned));
+  ASSERT_EQ(0x05, data[8]);
+  data[8] = 0x09;
+  EXPECT_EQ(9, copy.get_settings().get_gain());
+  EXPECT_EQ(9, moved.get_settings().get_gain());
+  EXPECT_EQ(9, result.get_settings().get_gain());
+  EXPECT_STREQ("abc", copy.get_name().get_const());
+}
+
+TEST(ReadBufferView, read)
+{
+  const std::array<uint8_t, 4> data = {1, 2, 3, 4};
+  ::EmbeddedProto::ReadBufferView view(data.data(), data.size());
+  uint8_t byte = 0;
+
+  EXPECT_EQ(4U, view.get_size());
+  EXPECT_EQ(data.data(), view.get_persistent_data(4));
+  EXPECT_TRUE(view.pop(byte));
+  EXPECT_EQ(1, byte);
+  EXPECT_EQ(nullptr, view.get_persistent_data(4));
+  EXPECT_EQ(data.data() + 1, view.get_persistent_data(3));
+  EXPECT_TRUE(view.advance(2));
+  EXPECT_FALSE(view.advance(2));
+  EXPECT_TRUE(view.peek(byte));
+  EXPECT_EQ(4, byte);
+  EXPECT_EQ(1U, view.get_size());
+
+  view.reset();
+  EXPECT_EQ(4U, view.get_size());
+}
+
+} // End of namespace test_EmbeddedAMS_LazyFields
@@ -0,0 +1,192 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WireFormatter.h>
+#include <WriteBufferFixedSize.h>
+
+#include <limits>
+
+// EAMS message definitions
+#include <simple_types.h>
+#include <repeated_fields.h>
+#include <oneof_fields.h>
+#include <field_options.h>
+
+namespace test_EmbeddedAMS_MaxSerializedSize
+{
+
+TEST(MaxSerializedSize, varint_and_tag_size)
+{
+  static_assert(1 == ::EmbeddedProto::WireFormatter::VarintSize(0), "VarintSize is not a constant expression.");
+  EXPECT_EQ(1U, ::EmbeddedProto::WireFormatter::VarintSize(127));
+  EXPECT_EQ(2U, ::EmbeddedProto::WireFormatter::VarintSize(128));
+  EXPECT_EQ(5U, ::EmbeddedProto::WireFormatter::VarintSize(std::numeric_limits<uint32_t>::max()));
+  EXPECT_EQ(10U, ::EmbeddedProto::WireFormatter::VarintSize(std::numeric_limits<uint64_t>::max()));
+
+  EXPECT_EQ(1U, ::EmbeddedProto::WireFormatter::TagSize(15));
+  EXPECT_EQ(2U, ::EmbeddedProto::WireFormatter::TagSize(16));
+  EXPECT_EQ(5U, ::EmbeddedProto::WireFormatter::TagSize(536870911));
+
+  EXPECT_EQ(1U + 2U + 200U, ::EmbeddedProto::WireFormatter::LengthDelimitedSize(1, 200));
+}
+
+TEST(MaxSerializedSize, fields)
+{
+  EXPECT_EQ(6U, ::EmbeddedProto::int32::max_serialized_size_with_id(1));
+  EXPECT_EQ(11U, ::EmbeddedProto::int64::max_serialized_size_with_id(1));
+  EXPECT_EQ(6U, ::EmbeddedProto::sint32::max_serialized_size_with_id(1));
+  EXPECT_EQ(2U, ::EmbeddedProto::boolean::max_serialized_size_with_id(1));
+  EXPECT_EQ(5U, ::EmbeddedProto::floatfixed::max_serialized_size_with_id(1));
+  EXPECT_EQ(10U, ::EmbeddedProto::doublefixed::max_serialized_size_with_id(16));
+
+  EXPECT_EQ(1U + 1U + 10U, ::EmbeddedProto::FieldString<10>::max_serialized_size_with_id(1));
+
+  // Packed with a single tag and length.
+  using uint32_array = ::EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::uint32, 4>;
+  EXPECT_EQ(1U + 1U + (4U * 5U), uint32_array::max_serialized_size_with_id(1));
+
+  // Unpacked with a tag and length per element.
+  using string_array = ::EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::FieldString<10>, 3>;
+  EXPECT_EQ(3U * (1U + 1U + 10U), string_array::max_serialized_size_with_id(1));
+}
+
+TEST(MaxSerializedSize, simple_types)
+{
+  Test_Simple_Types msg;
+  msg.set_a_int32(-1);
+  msg.set_a_int64(-1);
+  msg.set_a_uint32(std::numeric_limits<uint32_t>::max());
+  msg.set_a_uint64(std::numeric_limits<uint64_t>::max());
+  msg.set_a_sint32(std::numeric_limits<int32_t>::min());
+  msg.set_a_sint64(std::numeric_limits<int64_t>::min());
+  msg.set_a_bool(true);
+  msg.set_a_enum(Test_Enum::TWOBILLION);
+  msg.set_a_fixed64(1);
+  msg.set_a_sfixed64(1);
+  msg.set_a_double(1.0);
+  msg.set_a_fixed32(1);
+  msg.set_a_sfixed32(1);
+  msg.set_a_float(1.0F);
+  msg.set_a_nested_enum(Test_Simple_Types::Nested_Enum::NE_C);
+
+  // Fifteen one byte tags and the largest value of each type.
+  const uint32_t max_size = Test_Simple_Types::MAX_SERIALIZED_SIZE;
+  EXPECT_EQ(107U, max_size);
+
+  ::EmbeddedProto::WriteBufferFixedSize<Test_Simple_Types::MAX_SERIALIZED_SIZE> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  // The nested enum value only takes one byte instead of five.
+  EXPECT_EQ(max_size - 4U, buffer.get_size());
+}
+
+TEST(MaxSerializedSize, repeated_fields_exact)
+{
+  repeated_fields<5> msg;
+  msg.set_x(std::numeric_limits<uint32_t>::max());
+  msg.set_z(std::numeric_limits<uint32_t>::max());
+  for(uint32_t i = 0; i < 5; ++i)
+  {
+    msg.mutable_y().add(std::numeric_limits<uint32_t>::max());
+  }
+
+  const uint32_t max_size = repeated_fields<5>::MAX_SERIALIZED_SIZE;
+  EXPECT_EQ(39U, max_size);
+
+  ::EmbeddedProto::WriteBufferFixedSize<repeated_fields<5>::MAX_SERIALIZED_SIZE> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  EXPECT_EQ(max_size, buffer.get_size());
+  EXPECT_EQ(0U, buffer.get_available_size());
+}
+
+TEST(MaxSerializedSize, repeated_message_exact)
+{
+  repeated_message<3> msg;
+  msg.set_a(std::numeric_limits<uint32_t>::max());
+  msg.set_c(std::numeric_limits<uint32_t>::max());
+  repeated_nested_message nested;
+  nested.set_u(std::numeric_limits<uint32_t>::max());
+  nested.set_v(std::numeric_limits<uint32_t>::max());
+  for(uint32_t i = 0; i < 3; ++i)
+  {
+    msg.mutable_b().add(nested);
+  }
+
+  const uint32_t max_size = repeated_message<3>::MAX_SERIALIZED_SIZE;
+  EXPECT_EQ(54U, max_size);
+
+  ::EmbeddedProto::WriteBufferFixedSize<repeated_message<3>::MAX_SERIALIZED_SIZE> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  EXPECT_EQ(max_size, buffer.get_size());
+}
+
+TEST(MaxSerializedSize, string_exact)
+{
+  Options::StringMaxLength msg;
+  char text[257];
+  for(uint32_t i = 0; i < 256; ++i)
+  {
+    text[i] = 'a';
+  }
+  text[256] = '\0';
+  msg.mutable_s() = text;
+
+  const uint32_t max_size = Options::StringMaxLength::MAX_SERIALIZED_SIZE;
+  EXPECT_EQ(1U + 2U + 256U, max_size);
+
+  ::EmbeddedProto::WriteBufferFixedSize<Options::StringMaxLength::MAX_SERIALIZED_SIZE> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  EXPECT_EQ(max_size, buffer.get_size());
+}
+
+TEST(MaxSerializedSize, oneof)
+{
+  // The largest field in the oneof is counted.
+  const uint32_t max_size = Options::OneofWithMaxLength::MAX_SERIALIZED_SIZE;
+  const uint32_t max_string_size = Options::StringMaxLength::MAX_SERIALIZED_SIZE;
+  EXPECT_EQ(max_string_size, max_size);
+
+  // Use the fields with two byte tags in the oneofs to obtain the largest message.
+  message_oneof msg;
+  msg.set_a(-1);
+  msg.set_x(-1);
+  msg.set_b(-1);
+  msg.set_w(1.0F);
+  msg.mutable_msg_DEF().set_varD(-1);
+  msg.mutable_msg_DEF().set_varE(-1);
+  msg.mutable_msg_DEF().set_varF(-1);
+
+  ::EmbeddedProto::WriteBufferFixedSize<message_oneof::MAX_SERIALIZED_SIZE> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  EXPECT_EQ(0U, buffer.get_available_size());
+}
+
+} // End of namespace test_EmbeddedAMS_MaxSerializedSize
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <MessageBatch.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+
+// EAMS message definitions
+#include <nested_message.h>
+
+namespace test_EmbeddedAMS_MessageBatch
+{
+
+using MsgB = ::demo::space::message_b<3>;
+
+static void to_read_buffer(::EmbeddedProto::WriteBufferFixedSize<128>& write_buffer, 
+                           ::EmbeddedProto::ReadBufferFixedSize<128>& read_buffer)
+{
+  for(uint32_t i = 0; i < write_buffer.get_size(); ++i)
+  {
+    read_buffer.push(write_buffer.get_data()[i]);
+  }
+}
+
+TEST(MessageBatch, round_trip)
+{
+  std::array<MsgB, 3> messages;
+  messages[0].set_u(1.0);
+  messages[0].mutable_nested_a().add_x(1);
+  // The second message is empty and only takes its size byte.
+  messages[2].set_v(-5);
+
+  ::EmbeddedProto::WriteBufferFixedSize<128> write_buffer;
+  uint32_t n_serialized = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::serialize_batch(messages.data(), messages.size(), write_buffer, n_serialized));
+  EXPECT_EQ(messages.size(), n_serialized);
+  EXPECT_EQ(messages[0].serialized_size(), write_buffer.get_data()[0]);
+  EXPECT_EQ(0, write_buffer.get_data()[1 + messages[0].serialized_size()]);
+
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  to_read_buffer(write_buffer, read_buffer);
+
+  std::array<MsgB, 4> result;
+  result[1].set_u(2.0);
+  uint32_t n = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::deserialize_batch(read_buffer, result.data(), result.size(), n));
+  ASSERT_EQ(messages.size(), n);
+  for(uint32_t i = 0; i < n; ++i)
+  {
+    EXPECT_TRUE(messages[i] == result[i]);
+  }
+}
+
+TEST(MessageBatch, buffer_full)
+{
+  std::array<MsgB, 3> messages;
+  for(auto& msg : messages)
+  {
+    msg.set_u(1.0);
+  }
+
+  // Two messages of ten bytes fit.
+  ::EmbeddedProto::WriteBufferFixedSize<25> write_buffer;
+  uint32_t n_serialized = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::BUFFER_FULL, 
+            ::EmbeddedProto::serialize_batch(messages.data(), messages.size(), write_buffer, n_serialized));
+  EXPECT_EQ(2U, n_serialized);
+
+  // Nothing of the third message is written, not even its size.
+  EXPECT_EQ(20U, write_buffer.get_size());
+  ::EmbeddedProto::ReadBufferView read_buffer(write_buffer.get_data(), write_buffer.get_size());
+  std::array<MsgB, 3> result;
+  uint32_t n = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::deserialize_batch(read_buffer, result.data(), result.size(), n));
+  EXPECT_EQ(2U, n);
+}
+
+TEST(MessageBatch, array_full)
+{
+  std::array<MsgB, 3> messages;
+  for(auto& msg : messages)
+  {
+    msg.set_v(1);
+  }
+
+  ::EmbeddedProto::WriteBufferFixedSize<128> write_buffer;
+  uint32_t n_serialized = 0;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::serialize_batch(messages.data(), messages.size(), write_buffer, n_serialized));
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  to_read_buffer(write_buffer, read_buffer);
+
+  std::array<MsgB, 2> result;
+  uint32_t n = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, 
+            ::EmbeddedProto::deserialize_batch(read_buffer, result.data(), result.size(), n));
+  EXPECT_EQ(result.size(), n);
+  EXPECT_EQ(1, result[1].get_v());
+}
+
+TEST(MessageBatch, truncated)
+{
+  std::array<MsgB, 2> messages;
+  messages[0].set_v(1);
+  messages[1].set_u(1.0);
+
+  ::EmbeddedProto::WriteBufferFixedSize<128> write_buffer;
+  uint32_t n_serialized = 0;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::serialize_batch(messages.data(), messages.size(), write_buffer, n_serialized));
+
+  // Leave out the last byte.
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  for(uint32_t i = 0; i < (write_buffer.get_size() - 1); ++i)
+  {
+    read_buffer.push(write_buffer.get_data()[i]);
+  }
+
+  std::array<MsgB, 2> result;
+  uint32_t n = 0;
+  EXPECT_NE(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::deserialize_batch(read_buffer, result.data(), result.size(), n));
+  EXPECT_EQ(1U, n);
+}
+
+TEST(MessageBatch, truncated_frame)
+{
+  std::array<MsgB, 2> messages;
+  messages[0].set_v(1);
+  messages[1].set_u(1.0);
+  messages[1].set_v(2);
+
+  ::EmbeddedProto::WriteBufferFixedSize<128> write_buffer;
+  uint32_t n_serialized = 0;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            ::EmbeddedProto::serialize_batch(messages.data(), messages.size(), write_buffer, n_serialized));
+
+  // Leave out the last field, the data left ends on a field boundary.
+  ::EmbeddedProto::ReadBufferFixedSize<128> read_buffer;
+  for(uint32_t i = 0; i < (write_buffer.get_size() - 2); ++i)
+  {
+    read_buffer.push(write_buffer.get_data()[i]);
+  }
+
+  std::array<MsgB, 2> result;
+  uint32_t n = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, 
+            ::EmbeddedProto::deserialize_batch(read_buffer, result.data(), result.size(), n));
+  EXPECT_EQ(1U, n);
+
+  // The same for a buffer which limits the section to the bytes left.
+  ::EmbeddedProto::ReadBufferView view(write_buffer.get_data(), write_buffer.get_size() - 2);
+  n = 0;
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, 
+            ::EmbeddedProto::deserialize_batch(view, result.data(), result.size(), n));
+  EXPECT_EQ(1U, n);
+}
+
+} // End of namespace test_EmbeddedAMS_MessageBatch
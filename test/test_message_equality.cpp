@@ -0,0 +1,138 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <Errors.h>
+
+#include <cstdint>
+#include <unordered_set>
+
+// EAMS message definitions
+#include <oneof_fields.h>
+#include <optional_fields.h>
+#include <repeated_fields.h>
+#include <nested_message.h>
+
+namespace test_EmbeddedAMS_MessageEquality
+{
+
+using Optional = ::optional_fields<4, 4>;
+
+TEST(MessageEquality, nested_and_repeated)
+{
+  ::demo::space::message_b<3> lhs;
+  ::demo::space::message_b<3> rhs;
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+
+  lhs.set_u(1.0);
+  lhs.mutable_nested_a().add_x(1);
+  EXPECT_TRUE(lhs != rhs);
+  EXPECT_NE(lhs.hash(), rhs.hash());
+
+  rhs.set_u(1.0);
+  rhs.mutable_nested_a().add_x(1);
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+
+  // Only the elements in use are compared.
+  rhs.mutable_nested_a().add_x(2);
+  EXPECT_TRUE(lhs != rhs);
+  rhs.mutable_nested_a().mutable_x().clear();
+  rhs.mutable_nested_a().add_x(1);
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+
+  // Positive and negative zero are equal and give the same hash.
+  lhs.set_u(0.0);
+  rhs.set_u(-0.0);
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+}
+
+TEST(MessageEquality, strings_and_presence)
+{
+  Optional lhs;
+  Optional rhs;
+
+  // A field set to its default value differs from a field which is not set.
+  lhs.set_b(0);
+  EXPECT_TRUE(lhs != rhs);
+  EXPECT_NE(lhs.hash(), rhs.hash());
+  rhs.set_b(0);
+  EXPECT_TRUE(lhs == rhs);
+
+  lhs.mutable_str() = "abcd";
+  lhs.mutable_str() = "ab";
+  rhs.mutable_str() = "ab";
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+
+  rhs.mutable_str() = "abc";
+  EXPECT_TRUE(lhs != rhs);
+  EXPECT_NE(lhs.hash(), rhs.hash());
+}
+
+TEST(MessageEquality, oneof)
+{
+  message_oneof lhs;
+  message_oneof rhs;
+
+  lhs.set_x(0);
+  EXPECT_TRUE(lhs != rhs);
+  rhs.set_y(0);
+  EXPECT_TRUE(lhs != rhs);
+  EXPECT_NE(lhs.hash(), rhs.hash());
+  rhs.set_x(0);
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_EQ(lhs.hash(), rhs.hash());
+
+  lhs.mutable_msg_ABC().set_varA(1);
+  rhs.mutable_msg_ABC().set_varA(2);
+  EXPECT_TRUE(lhs != rhs);
+  rhs.mutable_msg_ABC().set_varA(1);
+  EXPECT_TRUE(lhs == rhs);
+}
+
+TEST(MessageEquality, std_hash)
+{
+  std::unordered_set<message_oneof> frames;
+  message_oneof msg;
+  msg.set_a(1);
+  frames.insert(msg);
+  msg.set_b(2);
+  frames.insert(msg);
+  frames.insert(msg);
+  EXPECT_EQ(2U, frames.size());
+  EXPECT_EQ(1U, frames.count(msg));
+}
+
+} // End of namespace test_EmbeddedAMS_MessageEquality
@@ -0,0 +1,310 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <MessageIndex.h>
+#include <Fields.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+#include <thread>
+
+// EAMS message definitions
+#include <nested_message.h>
+#include <repeated_fields.h>
+
+namespace test_EmbeddedAMS_MessageIndex
+{
+
+constexpr uint32_t SIZE_MSG_A = 3;
+
+using MsgA = ::demo::space::message_a<SIZE_MSG_A>;
+using MsgB = ::demo::space::message_b<SIZE_MSG_A>;
+
+static uint32_t field_id(const MsgB::FieldNumber id) { return static_cast<uint32_t>(id); }
+static uint32_t field_id(const MsgA::FieldNumber id) { return static_cast<uint32_t>(id); }
+
+class MessageIndexTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+      MsgB msg;
+      msg.set_u(1.0);
+      msg.mutable_nested_a().add_x(1);
+      msg.mutable_nested_a().add_x(2);
+      msg.mutable_nested_a().set_y(1.0F);
+      msg.mutable_nested_a().set_z(-1);
+      msg.set_v(5);
+      ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+    }
+
+    ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+};
+
+TEST_F(MessageIndexTest, build)
+{
+  ::EmbeddedProto::MessageIndex<4> index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  ASSERT_EQ(3U, index.get_n_entries());
+
+  // u: tag at 0, eight bytes of data.
+  EXPECT_EQ(field_id(MsgB::FieldNumber::U), index.get_entry(0).field_number);
+  EXPECT_EQ(::EmbeddedProto::WireFormatter::WireType::FIXED64, index.get_entry(0).wire_type);
+  EXPECT_EQ(1U, index.get_entry(0).offset);
+  EXPECT_EQ(8U, index.get_entry(0).size);
+
+  // nested_a, the size includes the length byte.
+  EXPECT_EQ(field_id(MsgB::FieldNumber::NESTED_A), index.get_entry(1).field_number);
+  EXPECT_EQ(::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED, index.get_entry(1).wire_type);
+  EXPECT_EQ(10U, index.get_entry(1).offset);
+
+  // v is the last field.
+  EXPECT_EQ(field_id(MsgB::FieldNumber::V), index.get_entry(2).field_number);
+  EXPECT_EQ(buffer.get_size(), index.get_entry(2).offset + index.get_entry(2).size);
+
+  EXPECT_TRUE(index.has(field_id(MsgB::FieldNumber::V)));
+  EXPECT_FALSE(index.has(10));
+  EXPECT_EQ(nullptr, index.find(10));
+}
+
+TEST_F(MessageIndexTest, get_fields)
+{
+  ::EmbeddedProto::MessageIndex<4> index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+
+  ::EmbeddedProto::int32 v;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get(field_id(MsgB::FieldNumber::V), v));
+  EXPECT_EQ(5, v.get());
+
+  ::EmbeddedProto::doublefixed u;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get(field_id(MsgB::FieldNumber::U), u));
+  EXPECT_EQ(1.0, u.get());
+
+  MsgA nested;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get(field_id(MsgB::FieldNumber::NESTED_A), nested));
+  EXPECT_EQ(2U, nested.get_x().get_length());
+  EXPECT_EQ(-1, nested.get_z());
+
+  ::EmbeddedProto::int32 missing;
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_FIELD_ID, index.get(10, missing));
+
+  // Decoding with the wrong type is detected.
+  ::EmbeddedProto::floatfixed wrong_type;
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, index.get(field_id(MsgB::FieldNumber::U), wrong_type));
+}
+
+TEST_F(MessageIndexTest, get_nested)
+{
+  ::EmbeddedProto::MessageIndex<4> index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+
+  ::EmbeddedProto::MessageIndex<3> nested_index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get_nested(field_id(MsgB::FieldNumber::NESTED_A), nested_index));
+  EXPECT_EQ(3U, nested_index.get_n_entries());
+
+  ::EmbeddedProto::sint64 z;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, nested_index.get(field_id(MsgA::FieldNumber::Z), z));
+  EXPECT_EQ(-1, z.get());
+
+  ::EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::int32, 4> x;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, nested_index.get(field_id(MsgA::FieldNumber::X), x));
+  ASSERT_EQ(2U, x.get_length());
+  EXPECT_EQ(2, x[1].get());
+
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, index.get_nested(field_id(MsgB::FieldNumber::V), nested_index));
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_FIELD_ID, index.get_nested(10, nested_index));
+}
+
+TEST(MessageIndex, get_nested_merges_occurrences)
+{
+  // Two concatenated messages are merged when decoded, also for the nested message.
+  MsgB first;
+  first.mutable_nested_a().add_x(1);
+  first.mutable_nested_a().set_y(1.0F);
+  first.mutable_nested_a().set_z(-1);
+  MsgB second;
+  second.mutable_nested_a().add_x(2);
+  second.mutable_nested_a().set_z(3);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, first.serialize(buffer));
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, second.serialize(buffer));
+
+  ::EmbeddedProto::MessageIndex<4> index;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(2U, index.count(field_id(MsgB::FieldNumber::NESTED_A)));
+
+  ::EmbeddedProto::MessageIndex<5> nested_index;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get_nested(field_id(MsgB::FieldNumber::NESTED_A), nested_index));
+  EXPECT_EQ(5U, nested_index.get_n_entries());
+
+  MsgB expected;
+  ::EmbeddedProto::ReadBufferView read_buffer(buffer.get_data(), buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, expected.deserialize(read_buffer));
+
+  ::EmbeddedProto::RepeatedFieldFixedSize<::EmbeddedProto::int32, SIZE_MSG_A> x;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, nested_index.get(field_id(MsgA::FieldNumber::X), x));
+  ASSERT_EQ(expected.get_nested_a().get_x().get_length(), x.get_length());
+  EXPECT_EQ(1, x[0].get());
+  EXPECT_EQ(2, x[1].get());
+
+  ::EmbeddedProto::floatfixed y;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, nested_index.get(field_id(MsgA::FieldNumber::Y), y));
+  EXPECT_EQ(expected.get_nested_a().get_y(), y.get());
+
+  ::EmbeddedProto::sint64 z;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, nested_index.get(field_id(MsgA::FieldNumber::Z), z));
+  EXPECT_EQ(expected.get_nested_a().get_z(), z.get());
+  EXPECT_EQ(3, z.get());
+
+  // A nested index which is too small reports it.
+  ::EmbeddedProto::MessageIndex<3> small_index;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, index.get_nested(field_id(MsgB::FieldNumber::NESTED_A), small_index));
+}
+
+TEST_F(MessageIndexTest, too_many_fields)
+{
+  ::EmbeddedProto::MessageIndex<2> index;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, index.build(buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(2U, index.get_n_entries());
+}
+
+TEST_F(MessageIndexTest, truncated)
+{
+  ::EmbeddedProto::MessageIndex<4> index;
+  // Cut of the data in the middle of the nested message.
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, index.build(buffer.get_data(), 14));
+  EXPECT_EQ(1U, index.get_n_entries());
+}
+
+TEST(MessageIndex, repeated_unpacked)
+{
+  repeated_message<4> msg;
+  repeated_nested_message nested;
+  nested.set_u(1);
+  msg.add_b(nested);
+  nested.set_u(2);
+  msg.add_b(nested);
+  msg.set_c(3);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  ::EmbeddedProto::MessageIndex<4> index;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(3U, index.get_n_entries());
+
+  // All occurrences are added to the repeated field.
+  ::EmbeddedProto::RepeatedFieldFixedSize<repeated_nested_message, 4> b;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get(static_cast<uint32_t>(repeated_message<4>::FieldNumber::B), b));
+  ASSERT_EQ(2U, b.get_length());
+  EXPECT_EQ(1U, b[0].get_u());
+  EXPECT_EQ(2U, b[1].get_u());
+}
+
+TEST(MessageIndex, repeated_elements_in_parallel)
+{
+  constexpr uint32_t N_ELEMENTS = 16;
+  const uint32_t field_b = static_cast<uint32_t>(repeated_message<N_ELEMENTS>::FieldNumber::B);
+  repeated_message<N_ELEMENTS> msg;
+  msg.set_a(1);
+  for(uint32_t i = 0; i < N_ELEMENTS; ++i)
+  {
+    repeated_nested_message nested;
+    nested.set_u(i * 1000);
+    nested.set_v(i);
+    msg.add_b(nested);
+  }
+  ::EmbeddedProto::WriteBufferFixedSize<256> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  ::EmbeddedProto::MessageIndex<N_ELEMENTS + 2> index;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(N_ELEMENTS, index.count(field_b));
+
+  repeated_message<N_ELEMENTS> result;
+  auto& b = result.mutable_b();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.prepare_elements(field_b, b));
+  ASSERT_EQ(N_ELEMENTS, b.get_length());
+
+  ::EmbeddedProto::Error first_result = ::EmbeddedProto::Error::END_OF_BUFFER;
+  std::thread worker([&]() { first_result = index.get_elements(field_b, 0, N_ELEMENTS / 2, b); });
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get_elements(field_b, N_ELEMENTS / 2, N_ELEMENTS, b));
+  worker.join();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, first_result);
+  ::EmbeddedProto::uint32 a;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get(static_cast<uint32_t>(repeated_message<N_ELEMENTS>::FieldNumber::A), a));
+  result.set_a(a);
+
+  EXPECT_TRUE(msg == result);
+
+  // Not enough space.
+  ::EmbeddedProto::RepeatedFieldFixedSize<repeated_nested_message, 4> small;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, index.prepare_elements(field_b, small));
+}
+
+TEST(MessageIndex, repeated_elements_error)
+{
+  repeated_message<4> msg;
+  repeated_nested_message nested;
+  nested.set_u(1);
+  msg.add_b(nested);
+  msg.add_b(nested);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  // Change the wire type of u in the second element to an invalid one.
+  ASSERT_EQ(0x08, buffer.get_data()[6]);
+  buffer.get_data()[6] = 0x0F;
+
+  // The same error as the normal deserialize is reported.
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  for(uint32_t i = 0; i < buffer.get_size(); ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+  repeated_message<4> sequential;
+  const auto expected = sequential.deserialize(read_buffer);
+  EXPECT_NE(::EmbeddedProto::Error::NO_ERRORS, expected);
+
+  ::EmbeddedProto::MessageIndex<4> index;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.build(buffer.get_data(), buffer.get_size()));
+  repeated_message<4> result;
+  const uint32_t field_b = static_cast<uint32_t>(repeated_message<4>::FieldNumber::B);
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.prepare_elements(field_b, result.mutable_b()));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, index.get_elements(field_b, 0, 1, result.mutable_b()));
+  EXPECT_EQ(expected, index.get_elements(field_b, 1, 1, result.mutable_b()));
+}
+
+} // End of namespace test_EmbeddedAMS_MessageIndex
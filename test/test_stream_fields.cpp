@@ -0,0 +1,543 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <ReadBufferFixedSize.h>
+#include <RepeatedFieldStream.h>
+#include <FieldBytesStream.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <string>
+
+// EAMS message definitions
+#include <stream_fields.h>
+
+namespace test_EmbeddedAMS_StreamFields
+{
+
+constexpr uint32_t MAX_STAMPS = 4;
+
+using Recording = ::Stream::Recording<MAX_STAMPS>;
+using StoredRecording = ::Stream::StoredRecording<10, 10, 10, 10, 10>;
+using Label = ::EmbeddedProto::FieldString<10>;
+
+// Compute the values on the fly instead of storing them.
+class ValueSource : public ::EmbeddedProto::RepeatedFieldSource<::EmbeddedProto::sint32>
+{
+  public:
+    explicit ValueSource(const uint32_t length) : length_(length) { }
+
+    uint32_t get_length() const override { return length_; }
+
+    ::EmbeddedProto::Error get(const uint32_t index, ::EmbeddedProto::sint32& element) const override
+    {
+      element = value(index);
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    static int32_t value(const uint32_t index) { return (static_cast<int32_t>(index) - 100) * 1000; }
+
+  private:
+    uint32_t length_;
+};
+
+// Provide the elements from a vector.
+template<class DATA_TYPE>
+class VectorSource : public ::EmbeddedProto::RepeatedFieldSource<DATA_TYPE>
+{
+  public:
+    uint32_t get_length() const override { return static_cast<uint32_t>(elements.size()); }
+
+    ::EmbeddedProto::Error get(const uint32_t index, DATA_TYPE& element) const override
+    {
+      element = elements[index];
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    std::vector<DATA_TYPE> elements;
+};
+
+// Collect the received elements in a vector.
+template<class DATA_TYPE>
+class VectorSink : public ::EmbeddedProto::RepeatedFieldSink<DATA_TYPE>
+{
+  public:
+    ::EmbeddedProto::Error push(const DATA_TYPE& element) override
+    {
+      elements.push_back(element);
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    std::vector<DATA_TYPE> elements;
+};
+
+static ::Stream::Sample make_sample(const uint32_t time, const int32_t value)
+{
+  ::Stream::Sample sample;
+  sample.set_time(time);
+  sample.set_value(value);
+  return sample;
+}
+
+TEST(StreamFields, same_as_stored)
+{
+  ValueSource values(5);
+  VectorSource<::EmbeddedProto::fixed32> stamps;
+  stamps.elements = {1, 2, 3};
+  VectorSource<::Stream::Sample> samples;
+  samples.elements = {make_sample(1, -1), make_sample(2, 0)};
+  VectorSource<Label> labels;
+  labels.elements.resize(2);
+  labels.elements[0] = "first";
+  labels.elements[1] = "";
+
+  Recording msg;
+  msg.set_id(7);
+  msg.set_values_source(&values);
+  msg.set_stamps_source(&stamps);
+  msg.set_samples_source(&samples);
+  msg.set_labels_source(&labels);
+
+  StoredRecording stored;
+  stored.set_id(7);
+  for(uint32_t i = 0; i < values.get_length(); ++i)
+  {
+    stored.add_values(ValueSource::value(i));
+  }
+  for(const auto& stamp : stamps.elements)
+  {
+    stored.add_stamps(stamp);
+  }
+  for(const auto& sample : samples.elements)
+  {
+    stored.add_samples(sample);
+  }
+  for(const auto& label : labels.elements)
+  {
+    stored.add_labels(label);
+  }
+
+  ::EmbeddedProto::WriteBufferFixedSize<256> buffer;
+  ::EmbeddedProto::WriteBufferFixedSize<256> expected;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, stored.serialize(expected));
+  ASSERT_EQ(expected.get_size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.get_data(), buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(buffer.get_size(), msg.serialized_size());
+
+  // Receive the elements again.
+  VectorSink<::EmbeddedProto::sint32> values_sink;
+  VectorSink<::EmbeddedProto::fixed32> stamps_sink;
+  VectorSink<::Stream::Sample> samples_sink;
+  VectorSink<Label> labels_sink;
+  Recording received;
+  received.set_values_sink(&values_sink);
+  received.set_stamps_sink(&stamps_sink);
+  received.set_samples_sink(&samples_sink);
+  received.set_labels_sink(&labels_sink);
+
+  ::EmbeddedProto::ReadBufferView read_buffer(buffer.get_data(), buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, received.deserialize(read_buffer));
+  EXPECT_EQ(7U, received.get_id());
+  ASSERT_EQ(5U, values_sink.elements.size());
+  for(uint32_t i = 0; i < values_sink.elements.size(); ++i)
+  {
+    EXPECT_EQ(ValueSource::value(i), values_sink.elements[i]);
+  }
+  EXPECT_EQ(stamps.elements, stamps_sink.elements);
+  EXPECT_EQ(samples.elements, samples_sink.elements);
+  ASSERT_EQ(2U, labels_sink.elements.size());
+  EXPECT_STREQ("first", labels_sink.elements[0].get_const());
+  EXPECT_EQ(0U, labels_sink.elements[1].get_length());
+  EXPECT_EQ(5U, received.get_values().get_n_received());
+
+  // After clearing the message the count starts again, the sinks are kept.
+  received.clear();
+  EXPECT_EQ(0U, received.get_values().get_n_received());
+  EXPECT_EQ(&values_sink, received.get_values().get_sink());
+}
+
+TEST(StreamFields, many_elements)
+{
+  // The size of the message does not depend on the maximum number of elements.
+  EXPECT_GT(1024U, sizeof(Recording));
+
+  constexpr uint32_t N = 50000;
+  ValueSource values(N);
+  Recording msg;
+  msg.set_values_source(&values);
+
+  static ::EmbeddedProto::WriteBufferFixedSize<4 * N> buffer;
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, Recording::validate(buffer.get_data(), buffer.get_size()));
+
+  // Check the elements as they are received without storing them.
+  class CheckSink : public ::EmbeddedProto::RepeatedFieldSink<::EmbeddedProto::sint32>
+  {
+    public:
+      ::EmbeddedProto::Error push(const ::EmbeddedProto::sint32& element) override
+      {
+        ok = ok && (ValueSource::value(n) == element);
+        ++n;
+        return ::EmbeddedProto::Error::NO_ERRORS;
+      }
+      uint32_t n = 0;
+      bool ok = true;
+  };
+  CheckSink sink;
+  Recording received;
+  received.set_values_sink(&sink);
+  ::EmbeddedProto::ReadBufferView read_buffer(buffer.get_data(), buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, received.deserialize(read_buffer));
+  EXPECT_EQ(N, sink.n);
+  EXPECT_TRUE(sink.ok);
+}
+
+TEST(StreamFields, max_length)
+{
+  VectorSource<::EmbeddedProto::fixed32> stamps;
+  stamps.elements = {1, 2, 3, 4, 5};
+  Recording msg;
+  msg.set_stamps_source(&stamps);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, msg.serialize(buffer));
+
+  // More elements are received than accepted.
+  StoredRecording stored;
+  for(const auto& stamp : stamps.elements)
+  {
+    stored.add_stamps(stamp);
+  }
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, stored.serialize(buffer));
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, Recording::validate(buffer.get_data(), buffer.get_size()));
+
+  VectorSink<::EmbeddedProto::fixed32> sink;
+  Recording received;
+  received.set_stamps_sink(&sink);
+  ::EmbeddedProto::ReadBufferView read_buffer(buffer.get_data(), buffer.get_size());
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, received.deserialize(read_buffer));
+  EXPECT_EQ(MAX_STAMPS, sink.elements.size());
+}
+
+TEST(StreamFields, errors)
+{
+  // An error of the source stops serializing.
+  class FailingSource : public ::EmbeddedProto::RepeatedFieldSource<::Stream::Sample>
+  {
+    public:
+      uint32_t get_length() const override { return 3; }
+      ::EmbeddedProto::Error get(const uint32_t index, ::Stream::Sample& element) const override
+      {
+        element.set_time(index);
+        return (1 == index) ? ::EmbeddedProto::Error::INDEX_OUT_OF_BOUND : ::EmbeddedProto::Error::NO_ERRORS;
+      }
+  };
+  FailingSource source;
+  Recording msg;
+  msg.set_samples_source(&source);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::INDEX_OUT_OF_BOUND, msg.serialize(buffer));
+
+  // An error of the sink stops deserializing.
+  class FullSink : public ::EmbeddedProto::RepeatedFieldSink<::EmbeddedProto::sint32>
+  {
+    public:
+      ::EmbeddedProto::Error push(const ::EmbeddedProto::sint32& element) override
+      {
+        static_cast<void>(element);
+        return ::EmbeddedProto::Error::BUFFER_FULL;
+      }
+  };
+  ValueSource values(3);
+  msg.set_samples_source(nullptr);
+  msg.set_values_source(&values);
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  FullSink sink;
+  Recording received;
+  received.set_values_sink(&sink);
+  ::EmbeddedProto::ReadBufferView read_buffer(buffer.get_data(), buffer.get_size());
+  EXPECT_EQ(::EmbeddedProto::Error::BUFFER_FULL, received.deserialize(read_buffer));
+
+  // Without a sink the elements are dropped.
+  Recording dropped;
+  ::EmbeddedProto::ReadBufferView read_again(buffer.get_data(), buffer.get_size());
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, dropped.deserialize(read_again));
+  EXPECT_EQ(3U, dropped.get_values().get_n_received());
+}
+
+TEST(StreamFields, equality)
+{
+  ValueSource a(10);
+  ValueSource b(10);
+  ValueSource c(11);
+  Recording msg_a;
+  Recording msg_b;
+  msg_a.set_values_source(&a);
+  msg_b.set_values_source(&b);
+  EXPECT_TRUE(msg_a == msg_b);
+  EXPECT_EQ(msg_a.hash(), msg_b.hash());
+
+  msg_b.set_values_source(&c);
+  EXPECT_TRUE(msg_a != msg_b);
+}
+
+using Transfer = ::Stream::Transfer<16>;
+using StoredTransfer = ::Stream::StoredTransfer<200, 16, 8, 10>;
+
+// Generate the data of a large blob on the fly.
+class PatternSource : public ::EmbeddedProto::BytesSource
+{
+  public:
+    explicit PatternSource(const uint32_t size) : size_(size) { }
+
+    uint32_t get_size() const override { return size_; }
+
+    ::EmbeddedProto::Error read(const uint32_t offset, uint8_t* data, const uint32_t n_bytes) const override
+    {
+      for(uint32_t i = 0; i < n_bytes; ++i)
+      {
+        data[i] = byte(offset + i);
+      }
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    static uint8_t byte(const uint32_t index) { return static_cast<uint8_t>((index * 7) ^ (index >> 8)); }
+
+  private:
+    uint32_t size_;
+};
+
+// Provide the data from a string.
+class StringSource : public ::EmbeddedProto::BytesSource
+{
+  public:
+    explicit StringSource(const char* text) : text_(text) { }
+
+    uint32_t get_size() const override { return static_cast<uint32_t>(strlen(text_)); }
+
+    ::EmbeddedProto::Error read(const uint32_t offset, uint8_t* data, const uint32_t n_bytes) const override
+    {
+      memcpy(data, text_ + offset, n_bytes);
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+  private:
+    const char* text_;
+};
+
+// Collect the received data and the size of each chunk.
+class CollectSink : public ::EmbeddedProto::BytesSink
+{
+  public:
+    ::EmbeddedProto::Error begin(const uint32_t size) override
+    {
+      expected = size;
+      data.clear();
+      chunks.clear();
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    ::EmbeddedProto::Error write(const uint8_t* bytes, const uint32_t n_bytes) override
+    {
+      data.append(reinterpret_cast<const char*>(bytes), n_bytes);
+      chunks.push_back(n_bytes);
+      return ::EmbeddedProto::Error::NO_ERRORS;
+    }
+
+    uint32_t expected = 0;
+    std::string data;
+    std::vector<uint32_t> chunks;
+};
+
+TEST(StreamFields, bytes_same_as_stored)
+{
+  constexpr uint32_t SIZE = 100;
+  PatternSource image(SIZE);
+  StringSource log("hello");
+  VectorSource<::EmbeddedProto::uint32> counts;
+  counts.elements = {1, 200, 30000};
+
+  Transfer msg;
+  msg.set_id(3);
+  msg.set_image_source(&image);
+  msg.set_log_source(&log);
+  msg.mutable_name() = "abc";
+  msg.set_counts_source(&counts);
+
+  StoredTransfer stored;
+  stored.set_id(3);
+  for(uint32_t i = 0; i < SIZE; ++i)
+  {
+    stored.mutable_image()[i] = PatternSource::byte(i);
+  }
+  stored.mutable_log() = "hello";
+  stored.mutable_name() = "abc";
+  for(const auto& count : counts.elements)
+  {
+    stored.add_counts(count);
+  }
+
+  ::EmbeddedProto::WriteBufferFixedSize<256> buffer;
+  ::EmbeddedProto::WriteBufferFixedSize<256> expected;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, stored.serialize(expected));
+  ASSERT_EQ(expected.get_size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.get_data(), buffer.get_data(), buffer.get_size()));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, Transfer::validate(buffer.get_data(), buffer.get_size()));
+
+  // Copies of the message use the same sources.
+  const Transfer copy(msg);
+  EXPECT_EQ(&image, copy.get_image().get_source());
+  EXPECT_TRUE(copy == msg);
+  EXPECT_EQ(copy.hash(), msg.hash());
+
+  // From a buffer holding all data, the sink receives the data in one call.
+  CollectSink image_sink;
+  CollectSink log_sink;
+  Transfer received;
+  received.set_image_sink(&image_sink);
+  received.set_log_sink(&log_sink);
+  ::EmbeddedProto::ReadBufferView view(buffer.get_data(), buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, received.deserialize(view));
+  EXPECT_EQ(SIZE, image_sink.expected);
+  ASSERT_EQ(SIZE, image_sink.data.size());
+  for(uint32_t i = 0; i < SIZE; ++i)
+  {
+    EXPECT_EQ(PatternSource::byte(i), static_cast<uint8_t>(image_sink.data[i]));
+  }
+  EXPECT_EQ(std::vector<uint32_t>({SIZE}), image_sink.chunks);
+  EXPECT_EQ("hello", log_sink.data);
+  EXPECT_STREQ("abc", received.get_name().get_const());
+
+  // Other buffers are read in chunks.
+  ::EmbeddedProto::ReadBufferFixedSize<256> fixed_buffer;
+  memcpy(fixed_buffer.get_data(), buffer.get_data(), buffer.get_size());
+  fixed_buffer.set_bytes_written(buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, received.deserialize(fixed_buffer));
+  EXPECT_EQ(std::vector<uint32_t>({32, 32, 32, 4}), image_sink.chunks);
+  ASSERT_EQ(SIZE, image_sink.data.size());
+  EXPECT_EQ(PatternSource::byte(SIZE - 1), static_cast<uint8_t>(image_sink.data[SIZE - 1]));
+}
+
+TEST(StreamFields, bytes_large)
+{
+  // The size of the message does not depend on the maximum size of the image.
+  EXPECT_GT(1024U, sizeof(Transfer));
+
+  constexpr uint32_t SIZE = 200000;
+  PatternSource image(SIZE);
+  Transfer msg;
+  msg.set_image_source(&image);
+
+  static ::EmbeddedProto::WriteBufferFixedSize<SIZE + 16> buffer;
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  // Check the data as it arrives without storing it.
+  class CheckSink : public ::EmbeddedProto::BytesSink
+  {
+    public:
+      ::EmbeddedProto::Error begin(const uint32_t size) override 
+      { 
+        total = size;
+        return ::EmbeddedProto::Error::NO_ERRORS; 
+      }
+
+      ::EmbeddedProto::Error write(const uint8_t* bytes, const uint32_t n_bytes) override
+      {
+        for(uint32_t i = 0; i < n_bytes; ++i)
+        {
+          ok = ok && (PatternSource::byte(n) == bytes[i]);
+          ++n;
+        }
+        return ::EmbeddedProto::Error::NO_ERRORS;
+      }
+
+      uint32_t total = 0;
+      uint32_t n = 0;
+      bool ok = true;
+  };
+  CheckSink sink;
+  Transfer received;
+  received.set_image_sink(&sink);
+  ::EmbeddedProto::ReadBufferView view(buffer.get_data(), buffer.get_size());
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, received.deserialize(view));
+  EXPECT_EQ(SIZE, sink.total);
+  EXPECT_EQ(SIZE, sink.n);
+  EXPECT_TRUE(sink.ok);
+}
+
+TEST(StreamFields, bytes_invalid)
+{
+  // The log accepts at most 16 bytes.
+  StringSource log("seventeen chars!!");
+  Transfer msg;
+  msg.set_log_source(&log);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, msg.serialize(buffer));
+
+  ::Stream::StoredTransfer<200, 32, 8, 10> stored;
+  stored.mutable_log() = "seventeen chars!!";
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, stored.serialize(buffer));
+  CollectSink sink;
+  Transfer received;
+  received.set_log_sink(&sink);
+  ::EmbeddedProto::ReadBufferView too_long(buffer.get_data(), buffer.get_size());
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, received.deserialize(too_long));
+
+  // The data ends before the end of the field.
+  StringSource short_log("sixteen chars!!!");
+  msg.set_log_source(&short_log);
+  buffer.clear();
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+  ::EmbeddedProto::ReadBufferFixedSize<64> truncated;
+  memcpy(truncated.get_data(), buffer.get_data(), buffer.get_size() - 1);
+  truncated.set_bytes_written(buffer.get_size() - 1);
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, received.deserialize(truncated));
+
+  // Without a sink the data is skipped.
+  Transfer skipped;
+  ::EmbeddedProto::ReadBufferView view(buffer.get_data(), buffer.get_size());
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, skipped.deserialize(view));
+}
+
+} // End of namespace test_EmbeddedAMS_StreamFields
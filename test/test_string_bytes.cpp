@@ -34,6 +34,8 @@
 #include <WireFormatter.h>
 #include <ReadBufferMock.h>
 #include <WriteBufferMock.h>
+#include <ReadBufferView.h>
+#include <Utf8.h>
 
 #include <cstdint>
 #include <limits>
@@ -797,6 +799,95 @@ TEST(RepeatedStringBytes, field_number_to_name)
                           "nested_bytes"));
 }
 
+TEST(FieldString, assign_shorter)
+{
+  ::EmbeddedProto::FieldString<10> a;
+  ::EmbeddedProto::FieldString<10> b;
+  a = "Foo bar";
+  b = "Foo";
+
+  a = b;
+  EXPECT_EQ(3U, a.get_length());
+  EXPECT_STREQ("Foo", a.get_const());
+
+  ::EmbeddedProto::FieldString<10> c(std::move(b));
+  EXPECT_EQ(3U, c.get_length());
+  EXPECT_STREQ("Foo", c.get_const());
+}
+
+TEST(RepeatedStringBytes, move_msg)
+{
+  repeated_string_bytes<3, 10, 3, 10, 10, 10> msg;
+  msg.add_array_of_txt(::EmbeddedProto::FieldString<10>());
+  msg.mutable_array_of_txt(0) = "Foo bar";
+  msg.mutable_nested_text().mutable_txt() = "A.B";
+  const std::array<uint8_t, 3> b = {1, 2, 3};
+  msg.mutable_nested_bytes().mutable_b().set(b.data(), 3);
+
+  repeated_string_bytes<3, 10, 3, 10, 10, 10> moved(std::move(msg));
+  EXPECT_EQ(1U, moved.get_array_of_txt().get_length());
+  EXPECT_STREQ("Foo bar", moved.array_of_txt(0).get_const());
+  EXPECT_STREQ("A.B", moved.get_nested_text().txt());
+  EXPECT_EQ(3U, moved.get_nested_bytes().get_b().get_length());
+
+  string_or_bytes<10, 10, 10, 10> msg_oneof;
+  msg_oneof.mutable_txt() = "Foo";
+  msg_oneof.set_nested_text(std::move(moved.mutable_nested_text()));
+
+  string_or_bytes<10, 10, 10, 10> assigned;
+  assigned.mutable_b().set(b.data(), 3);
+  assigned = std::move(msg_oneof);
+  EXPECT_TRUE(assigned.has_txt());
+  EXPECT_STREQ("Foo", assigned.txt());
+  EXPECT_STREQ("A.B", assigned.get_nested_text().txt());
+}
+
+TEST(FieldString, valid_utf8)
+{
+  const auto valid = [](const char* str) 
+  { 
+    return ::EmbeddedProto::is_valid_utf8(reinterpret_cast<const uint8_t*>(str), strlen(str)); 
+  };
+
+  EXPECT_TRUE(valid(""));
+  EXPECT_TRUE(valid("Only ASCII characters in this text."));
+  EXPECT_TRUE(valid("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xED\x9F\xBF \xF4\x8F\xBF\xBF"));
+
+  // A continuation byte without a lead byte.
+  EXPECT_FALSE(valid("abc\x80"));
+  // Overlong encodings.
+  EXPECT_FALSE(valid("\xC0\xAF"));
+  EXPECT_FALSE(valid("\xE0\x80\xAF"));
+  EXPECT_FALSE(valid("\xF0\x80\x80\xAF"));
+  // Surrogates and code points above U+10FFFF.
+  EXPECT_FALSE(valid("\xED\xA0\x80"));
+  EXPECT_FALSE(valid("\xF4\x90\x80\x80"));
+  EXPECT_FALSE(valid("\xF5\x80\x80\x80"));
+  // Truncated in the middle of a character, also after a block of ASCII.
+  EXPECT_FALSE(valid("\xE2\x82"));
+  EXPECT_FALSE(valid("0123456789\xF0\x9F\x98"));
+  EXPECT_FALSE(valid("\xC3\x28"));
+}
+
+#ifdef MSG_VALIDATE_UTF8
+
+TEST(FieldString, deserialize_invalid_utf8)
+{
+  text<10> msg;
+  const uint8_t valid[] = {0x0A, 0x02, 0xC3, 0xA9};
+  ::EmbeddedProto::ReadBufferView valid_buffer(valid, sizeof(valid));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.deserialize(valid_buffer));
+  EXPECT_EQ(2U, msg.get_txt().get_length());
+
+  msg.clear();
+  const uint8_t invalid[] = {0x0A, 0x02, 0xC3, 0x28};
+  ::EmbeddedProto::ReadBufferView invalid_buffer(invalid, sizeof(invalid));
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_UTF8, msg.deserialize(invalid_buffer));
+  EXPECT_EQ(0U, msg.get_txt().get_length());
+}
+
+#endif // MSG_VALIDATE_UTF8
+
 #ifdef MSG_TO_STRING
 
 TEST(RepeatedStringBytes, to_string)
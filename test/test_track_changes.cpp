@@ -0,0 +1,271 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferFixedSize.h>
+#include <Errors.h>
+
+#include <cstdint>
+#include <array>
+#include <string.h>
+
+// EAMS message definitions
+#include <track_changes.h>
+
+namespace test_EmbeddedAMS_TrackChanges
+{
+
+template<class MSG_TYPE>
+static void merge(::EmbeddedProto::WriteBufferFixedSize<64>& buffer, MSG_TYPE& msg)
+{
+  ::EmbeddedProto::ReadBufferFixedSize<64> read_buffer;
+  for(uint32_t i = 0; i < buffer.get_size(); ++i)
+  {
+    read_buffer.push(buffer.get_data()[i]);
+  }
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.deserialize(read_buffer));
+}
+
+TEST(TrackChanges, setters_mark_fields)
+{
+  ::Changes::Status msg;
+  EXPECT_FALSE(msg.is_changed());
+
+  msg.set_counter(1);
+  msg.mutable_position().set_x(2);
+  msg.add_errors(3);
+  msg.set_sensor(4);
+  EXPECT_TRUE(msg.is_changed());
+  EXPECT_TRUE(msg.get_changed().is_set(::Changes::Status::FieldNumber::COUNTER));
+  EXPECT_TRUE(msg.get_changed().is_set(::Changes::Status::FieldNumber::POSITION));
+  EXPECT_TRUE(msg.get_changed().is_set(::Changes::Status::FieldNumber::ERRORS));
+  EXPECT_TRUE(msg.get_changed().is_set(::Changes::Status::FieldNumber::SENSOR));
+  EXPECT_FALSE(msg.get_changed().is_set(::Changes::Status::FieldNumber::TEMPERATURE));
+
+  // Reading does not change anything.
+  msg.mark_clean();
+  EXPECT_EQ(1U, msg.get_counter());
+  EXPECT_EQ(2, msg.get_position().get_x());
+  EXPECT_FALSE(msg.is_changed());
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  EXPECT_EQ(0U, buffer.get_size());
+  EXPECT_EQ(0U, msg.serialized_size_changed());
+}
+
+TEST(TrackChanges, serialize_changed)
+{
+  ::Changes::Status msg;
+  msg.set_counter(1);
+  msg.set_temperature(20.0F);
+  msg.set_mode(::Changes::Mode::RUN);
+  msg.mutable_name() = "abc";
+  msg.mutable_position().set_x(2);
+  msg.set_offset(5);
+
+  // The first time all values are send.
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  ::Changes::Status receiver;
+  merge(buffer, receiver);
+  EXPECT_EQ(1U, receiver.get_counter());
+  EXPECT_EQ(20.0F, receiver.get_temperature());
+  EXPECT_STREQ("abc", receiver.name());
+  msg.mark_clean();
+
+  // Only the counter changes.
+  msg.set_counter(2);
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  const std::array<uint8_t, 2> expected = {0x08, 0x02};
+  ASSERT_EQ(expected.size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.data(), buffer.get_data(), expected.size()));
+  EXPECT_EQ(expected.size(), msg.serialized_size_changed());
+  merge(buffer, receiver);
+  EXPECT_EQ(2U, receiver.get_counter());
+  EXPECT_EQ(20.0F, receiver.get_temperature());
+  msg.mark_clean();
+
+  // Values changed to their default are also send so the receiver picks them up.
+  msg.set_temperature(0.0F);
+  msg.set_mode(::Changes::Mode::IDLE);
+  msg.clear_name();
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  merge(buffer, receiver);
+  EXPECT_EQ(2U, receiver.get_counter());
+  EXPECT_EQ(0.0F, receiver.get_temperature());
+  EXPECT_EQ(::Changes::Mode::IDLE, receiver.get_mode());
+  EXPECT_EQ(0U, receiver.get_name().get_length());
+  EXPECT_EQ(2, receiver.get_position().get_x());
+  EXPECT_EQ(5, receiver.get_offset());
+}
+
+TEST(TrackChanges, merge_into_stale_copy)
+{
+  ::Changes::Status msg;
+  msg.set_counter(1);
+  msg.set_temperature(20.0F);
+  msg.mutable_name() = "abc";
+  msg.mutable_position().set_x(2);
+  msg.add_errors(7);
+  msg.set_offset(5);
+  msg.set_sensor(3);
+  msg.mark_clean();
+
+  // The receiver holds the state from before the changes.
+  ::Changes::Status receiver(msg);
+  ASSERT_TRUE(receiver == msg);
+
+  msg.set_counter(2);
+  msg.set_temperature(0.0F);
+  msg.set_mode(::Changes::Mode::RUN);
+  msg.clear_name();
+  msg.mutable_position().set_y(4);
+  msg.set_offset(0);
+  msg.mutable_target().set_x(6);
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  merge(buffer, receiver);
+  EXPECT_TRUE(receiver == msg);
+}
+
+TEST(TrackChanges, merge_limitations)
+{
+  ::Changes::Status msg;
+  msg.mutable_position().set_x(2);
+  msg.add_errors(7);
+  msg.set_offset(5);
+  msg.mark_clean();
+
+  // A nested field reset to its default is not serialized.
+  ::Changes::Status receiver(msg);
+  msg.mutable_position().set_x(0);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  merge(buffer, receiver);
+  EXPECT_EQ(2, receiver.get_position().get_x());
+  msg.mark_clean();
+
+  // Repeated fields are appended.
+  receiver = msg;
+  msg.add_errors(8);
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  merge(buffer, receiver);
+  EXPECT_EQ(3U, receiver.get_errors().get_length());
+  msg.mark_clean();
+
+  // Clearing an optional field writes nothing.
+  receiver = msg;
+  msg.clear_offset();
+  buffer.clear();
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  EXPECT_EQ(0U, buffer.get_size());
+  merge(buffer, receiver);
+  EXPECT_TRUE(receiver.has_offset());
+}
+
+TEST(TrackChanges, oneof)
+{
+  ::Changes::Status msg;
+  msg.set_sensor(1);
+  msg.mark_clean();
+
+  msg.mutable_target().set_y(3);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+
+  ::Changes::Status receiver;
+  receiver.set_sensor(1);
+  merge(buffer, receiver);
+  EXPECT_EQ(::Changes::Status::FieldNumber::TARGET, receiver.get_which_source());
+  EXPECT_EQ(3, receiver.get_target().get_y());
+}
+
+TEST(TrackChanges, compact_layout)
+{
+  ::Changes::Flags msg;
+  msg.set_active(true);
+  msg.set_level(2);
+  msg.mark_clean();
+
+  msg.set_active(false);
+  EXPECT_TRUE(msg.get_changed().is_set(::Changes::Flags::FieldNumber::ACTIVE));
+  EXPECT_FALSE(msg.get_changed().is_set(::Changes::Flags::FieldNumber::LEVEL));
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize_changed(buffer));
+  const std::array<uint8_t, 2> expected = {0x08, 0x00};
+  ASSERT_EQ(expected.size(), buffer.get_size());
+  EXPECT_EQ(0, memcmp(expected.data(), buffer.get_data(), expected.size()));
+}
+
+TEST(TrackChanges, deserialize_compact_layout)
+{
+  ::Changes::Flags sender;
+  sender.set_active(true);
+  sender.set_error(false);
+  sender.set_level(3);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, sender.serialize(buffer));
+
+  // Received data is not a change, also not for the bits of the bool fields.
+  ::Changes::Flags receiver;
+  receiver.set_error(true);
+  receiver.mark_clean();
+  merge(buffer, receiver);
+  EXPECT_TRUE(receiver.get_active());
+  EXPECT_TRUE(receiver.get_error());
+  EXPECT_EQ(3U, receiver.get_level());
+  EXPECT_FALSE(receiver.is_changed());
+  EXPECT_FALSE(receiver.get_changed().is_set(::Changes::Flags::FieldNumber::ACTIVE));
+
+  // A bool which is received as false is cleared.
+  const std::array<uint8_t, 2> error_false = {0x10, 0x00};
+  buffer.clear();
+  for(const uint8_t byte : error_false)
+  {
+    buffer.push(byte);
+  }
+  merge(buffer, receiver);
+  EXPECT_FALSE(receiver.get_error());
+  EXPECT_FALSE(receiver.is_changed());
+
+  ::EmbeddedProto::WriteBufferFixedSize<64> changed_buffer;
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, receiver.serialize_changed(changed_buffer));
+  EXPECT_EQ(0U, changed_buffer.get_size());
+}
+
+} // End of namespace test_EmbeddedAMS_TrackChanges
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+
+#include "gtest/gtest.h"
+
+#include <Fields.h>
+#include <RepeatedFieldFixedSize.h>
+
+#include <type_traits>
+
+// EAMS message definitions
+#include <compact_layout.h>
+
+namespace test_EmbeddedAMS_TriviallyCopyable
+{
+
+TEST(TriviallyCopyable, fields)
+{
+  EXPECT_TRUE(std::is_trivially_copyable<EmbeddedProto::uint32>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<EmbeddedProto::doublefixed>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<EmbeddedProto::boolean>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<EmbeddedProto::enumeration<Compact::CompactMixed::Offset>>::value);
+}
+
+TEST(TriviallyCopyable, copy_message)
+{
+  Compact::CompactMixed a;
+  a.set_offset(Compact::CompactMixed::Offset::LARGE);
+  a.add_flags(true);
+  a.add_flags(false);
+  a.mutable_nested().set_enabled(true);
+  a.mutable_nested().set_count(7);
+  a.set_choice_value(42);
+  a.set_last(true);
+
+  Compact::CompactMixed b(a);
+  EXPECT_EQ(Compact::CompactMixed::Offset::LARGE, b.get_offset());
+  EXPECT_EQ(2U, b.flags().get_length());
+  EXPECT_TRUE(b.flags(0));
+  EXPECT_FALSE(b.flags(1));
+  EXPECT_TRUE(b.nested().get_enabled());
+  EXPECT_EQ(7U, b.nested().get_count());
+  EXPECT_EQ(Compact::CompactMixed::FieldNumber::CHOICE_VALUE, b.get_which_choice());
+  EXPECT_EQ(42U, b.get_choice_value());
+  EXPECT_TRUE(b.get_last());
+
+  Compact::CompactMixed c;
+  c.set_choice_flag(true);
+  c = a;
+  EXPECT_EQ(Compact::CompactMixed::FieldNumber::CHOICE_VALUE, c.get_which_choice());
+  EXPECT_EQ(42U, c.get_choice_value());
+  EXPECT_EQ(7U, c.nested().get_count());
+}
+
+TEST(TriviallyCopyable, assign_repeated_only_used_elements)
+{
+  EmbeddedProto::RepeatedFieldFixedSize<EmbeddedProto::uint32, 4> a;
+  EmbeddedProto::RepeatedFieldFixedSize<EmbeddedProto::uint32, 4> b;
+  b.add(1);
+  b.add(2);
+  b.add(3);
+  a.add(9);
+
+  b = a;
+  EXPECT_EQ(1U, b.get_length());
+  EXPECT_EQ(9U, b[0]);
+
+  // The elements which are no longer in use are cleared.
+  EXPECT_EQ(0U, b.get_data_const()[1]);
+  EXPECT_EQ(0U, b.get_data_const()[2]);
+
+  b.add(4);
+  b.add(5);
+  b = std::move(a);
+  EXPECT_EQ(1U, b.get_length());
+  EXPECT_EQ(0U, b.get_data_const()[1]);
+  EXPECT_EQ(0U, b.get_data_const()[2]);
+}
+
+} // End of namespace test_EmbeddedAMS_TriviallyCopyable
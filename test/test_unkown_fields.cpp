@@ -36,12 +36,15 @@
 #include <WireFormatter.h>
 #include <ReadBufferMock.h>
 #include <WriteBufferMock.h>
+#include <ReadBufferView.h>
+#include <ReadBufferFixedSize.h>
 
 #include <cstdint>    
 #include <limits> 
 
 // EAMS message definitions
 #include <simple_types.h>
+#include <empty_message.h>
 
 using ::testing::_;
 using ::testing::InSequence;
@@ -90,12 +93,18 @@ TEST(UnknownFields, fixed32)
 
   ::Test_Simple_Types msg;
 
-  std::array<uint8_t, N_BYTES> referee = { 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, // a_int32
-                                           0x9D, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, // Additional fixed32
-                                           0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // a_uint32
-                                         };
+  std::array<uint8_t, 8> referee_1 = { 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, // a_int32
+                                       0x9D, 0x03, // Tag of additional fixed32
+                                     };
+  for(auto r: referee_1) {
+    EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(DoAll(SetArgReferee<0>(r), Return(true)));
+  }
 
-  for(auto r: referee) {
+  // The value itself is skipped without reading it.
+  EXPECT_CALL(buffer, advance(4)).Times(1).WillOnce(Return(true));
+
+  std::array<uint8_t, 6> referee_2 = { 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F}; // a_uint32
+  for(auto r: referee_2) {
     EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(DoAll(SetArgReferee<0>(r), Return(true)));
   }
   EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(Return(false));
@@ -117,12 +126,18 @@ TEST(UnknownFields, fixed64)
 
   ::Test_Simple_Types msg;
 
-  std::array<uint8_t, N_BYTES> referee = { 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, // a_int32
-                                           0xA1, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Additional fixed64
-                                           0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // a_uint32
-                                         };
+  std::array<uint8_t, 8> referee_1 = { 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, // a_int32
+                                       0xA1, 0x03, // Tag of additional fixed64
+                                     };
+  for(auto r: referee_1) {
+    EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(DoAll(SetArgReferee<0>(r), Return(true)));
+  }
 
-  for(auto r: referee) {
+  // The value itself is skipped without reading it.
+  EXPECT_CALL(buffer, advance(8)).Times(1).WillOnce(Return(true));
+
+  std::array<uint8_t, 6> referee_2 = { 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F}; // a_uint32
+  for(auto r: referee_2) {
     EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(DoAll(SetArgReferee<0>(r), Return(true)));
   }
   EXPECT_CALL(buffer, pop(_)).Times(1).WillOnce(Return(false));
@@ -156,7 +171,7 @@ TEST(UnknownFields, length_delimited)
   }
 
   // 0x01, 0x02, 0x03, 0x04, 0x05, 
-  EXPECT_CALL(buffer, advance(5));
+  EXPECT_CALL(buffer, advance(5)).Times(1).WillOnce(Return(true));
 
   std::array<uint8_t, 6> referee_3 = { 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F}; // a_uint32
   for(auto r: referee_3) {
@@ -171,4 +186,69 @@ TEST(UnknownFields, length_delimited)
   EXPECT_EQ(std::numeric_limits<uint32_t>::max(), msg.get_a_uint32());  
 }
 
+TEST(UnknownFields, group) 
+{
+  ::Test_Simple_Types msg;
+
+  const uint8_t data[] = { 0x08, 0x01, // a_int32
+                           0x93, 0x03, // Start of group 50
+                           0x08, 0x05, // A field in the group with the same number as a_int32
+                           0x9B, 0x03, // Start of nested group 51
+                           0x15, 0x01, 0x02, 0x03, 0x04, // A fixed32 in the nested group
+                           0x9C, 0x03, // End of group 51
+                           0x94, 0x03, // End of group 50
+                           0x18, 0x02, // a_uint32
+                         };
+  ::EmbeddedProto::ReadBufferView buffer(data, sizeof(data));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.deserialize(buffer));
+  EXPECT_EQ(1, msg.get_a_int32()); 
+  EXPECT_EQ(2U, msg.get_a_uint32());
+
+  // A group which is not closed.
+  ::EmbeddedProto::ReadBufferView open_group(data, 8);
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, msg.deserialize(open_group));
+
+  // An end without a start.
+  const uint8_t end_only[] = { 0x94, 0x03 };
+  ::EmbeddedProto::ReadBufferView end_buffer(end_only, sizeof(end_only));
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, msg.deserialize(end_buffer));
+}
+
+TEST(UnknownFields, truncated) 
+{
+  ::Test_Simple_Types msg;
+
+  // The length delimited field claims more bytes than available.
+  const uint8_t length_delimited[] = { 0xAA, 0x03, 0x05, 0x01, 0x02 };
+  ::EmbeddedProto::ReadBufferView ld_buffer(length_delimited, sizeof(length_delimited));
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, msg.deserialize(ld_buffer));
+
+  const uint8_t fixed64[] = { 0xA1, 0x03, 0x01, 0x02, 0x03 };
+  ::EmbeddedProto::ReadBufferView fixed_buffer(fixed64, sizeof(fixed64));
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, msg.deserialize(fixed_buffer));
+
+  const uint8_t varint[] = { 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+  ::EmbeddedProto::ReadBufferView varint_buffer(varint, sizeof(varint));
+  EXPECT_EQ(::EmbeddedProto::Error::OVERLONG_VARINT, msg.deserialize(varint_buffer));
+
+  // A length which would wrap the read index around when added to it.
+  const uint8_t wrapping_length[] = { 0xAA, 0x03, 0xFA, 0xFF, 0xFF, 0xFF, 0x0F };
+  ::EmbeddedProto::ReadBufferFixedSize<sizeof(wrapping_length)> wrapping_buffer;
+  for(const uint8_t byte : wrapping_length)
+  {
+    wrapping_buffer.push(byte);
+  }
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, msg.deserialize(wrapping_buffer));
+
+  // The same for a message without any fields.
+  ::empty_message empty;
+  const uint8_t empty_wrapping_length[] = { 0x7A, 0xFA, 0xFF, 0xFF, 0xFF, 0x0F };
+  ::EmbeddedProto::ReadBufferFixedSize<sizeof(empty_wrapping_length)> empty_wrapping_buffer;
+  for(const uint8_t byte : empty_wrapping_length)
+  {
+    empty_wrapping_buffer.push(byte);
+  }
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, empty.deserialize(empty_wrapping_buffer));
+}
+
 } // End of namespace test_EmbeddedAMS_UnknownFields
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2020-2024 Embedded AMS B.V. - All Rights Reserved
+ *
+ *  This file is part of Embedded Proto.
+ *
+ *  Embedded Proto is open source software: you can redistribute it and/or 
+ *  modify it under the terms of the GNU General Public License as published 
+ *  by the Free Software Foundation, version 3 of the license.
+ *
+ *  Embedded Proto  is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Embedded Proto. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *  For commercial and closed source application please visit:
+ *  <https://EmbeddedProto.com/license/>.
+ *
+ *  Embedded AMS B.V.
+ *  Info:
+ *    info at EmbeddedProto dot com
+ *
+ *  Postal address:
+ *    Atoomweg 2
+ *    1627 LE, Hoorn
+ *    the Netherlands
+ */
+
+#include "gtest/gtest.h"
+
+#include <WriteBufferFixedSize.h>
+#include <ReadBufferView.h>
+#include <MessageInterface.h>
+#include <Errors.h>
+
+#include <cstdint>
+
+// EAMS message definitions
+#include <nested_message.h>
+#include <string_bytes.h>
+
+namespace test_EmbeddedAMS_Validate
+{
+
+using MsgA = ::demo::space::message_a<3>;
+using MsgB = ::demo::space::message_b<3>;
+// At most two strings of three characters, one bytes array and nested strings of three characters.
+using MsgStr = ::repeated_string_bytes<2, 3, 1, 3, 3, 3>;
+
+TEST(Validate, valid)
+{
+  MsgB msg;
+  msg.set_u(1.0);
+  msg.mutable_nested_a().add_x(1);
+  msg.mutable_nested_a().add_x(-2);
+  msg.mutable_nested_a().set_y(1.0F);
+  msg.mutable_nested_a().set_z(-1);
+  msg.set_v(5);
+  ::EmbeddedProto::WriteBufferFixedSize<64> buffer;
+  ASSERT_EQ(::EmbeddedProto::Error::NO_ERRORS, msg.serialize(buffer));
+
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(buffer.get_data(), buffer.get_size()));
+
+  // Leaving out the last byte cuts the value of v.
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgB::validate(buffer.get_data(), buffer.get_size() - 1));
+
+  // No data at all is a message with all default values.
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(buffer.get_data(), 0));
+}
+
+TEST(Validate, unknown_fields)
+{
+  // Field 10 is not part of message b and is skipped, also when it is a group.
+  const uint8_t data[] = {0x50, 0x01, 0x5B, 0x08, 0x01, 0x5C, 0x18, 0x05};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(data, sizeof(data)));
+}
+
+TEST(Validate, wire_type)
+{
+  // Field u is a double but send as a varint.
+  const uint8_t data_u[] = {0x08, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, MsgB::validate(data_u, sizeof(data_u)));
+
+  // The nested message send as a varint.
+  const uint8_t data_nested[] = {0x10, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_WIRETYPE, MsgB::validate(data_nested, sizeof(data_nested)));
+
+  // A zero field number.
+  const uint8_t data_zero[] = {0x00, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::INVALID_FIELD_ID, MsgB::validate(data_zero, sizeof(data_zero)));
+}
+
+TEST(Validate, varint)
+{
+  const uint8_t overlong[] = {0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::OVERLONG_VARINT, MsgB::validate(overlong, sizeof(overlong)));
+
+  const uint8_t unterminated[] = {0x18, 0xFF, 0xFF};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgB::validate(unterminated, sizeof(unterminated)));
+}
+
+TEST(Validate, nested_bounds)
+{
+  // The nested message claims five bytes but only two are left.
+  const uint8_t truncated[] = {0x12, 0x05, 0x18, 0x01};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgB::validate(truncated, sizeof(truncated)));
+
+  // A field in the nested message runs past the end of the nested message.
+  const uint8_t overrun[] = {0x12, 0x02, 0x15, 0x00, 0x00, 0x80, 0x3F};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgB::validate(overrun, sizeof(overrun)));
+
+  // An empty nested message followed by v.
+  const uint8_t empty[] = {0x12, 0x00, 0x18, 0x05};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(empty, sizeof(empty)));
+}
+
+TEST(Validate, repeated_length)
+{
+  // Three packed elements fit in x.
+  const uint8_t three[] = {0x12, 0x05, 0x0A, 0x03, 0x01, 0x02, 0x03};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(three, sizeof(three)));
+
+  const uint8_t four[] = {0x12, 0x06, 0x0A, 0x04, 0x01, 0x02, 0x03, 0x04};
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, MsgB::validate(four, sizeof(four)));
+
+  // Packed elements split over two tags are counted together.
+  const uint8_t split[] = {0x12, 0x08, 0x0A, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x03, 0x04};
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, MsgB::validate(split, sizeof(split)));
+
+  // The packed array is longer than the data left.
+  const uint8_t truncated[] = {0x0A, 0x05, 0x01, 0x02};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgA::validate(truncated, sizeof(truncated)));
+
+  // Each nested message has its own count.
+  const uint8_t twice[] = {0x12, 0x05, 0x0A, 0x03, 0x01, 0x02, 0x03, 0x12, 0x05, 0x0A, 0x03, 0x01, 0x02, 0x03};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgB::validate(twice, sizeof(twice)));
+
+  // Unpacked strings have a tag per element.
+  const uint8_t two_txt[] = {0x0A, 0x01, 'a', 0x0A, 0x00};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgStr::validate(two_txt, sizeof(two_txt)));
+
+  const uint8_t three_txt[] = {0x0A, 0x01, 'a', 0x0A, 0x00, 0x0A, 0x01, 'c'};
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, MsgStr::validate(three_txt, sizeof(three_txt)));
+}
+
+TEST(Validate, max_length)
+{
+  const uint8_t fits[] = {0x0A, 0x03, 'a', 'b', 'c'};
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, MsgStr::validate(fits, sizeof(fits)));
+
+  const uint8_t too_long[] = {0x0A, 0x04, 'a', 'b', 'c', 'd'};
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, MsgStr::validate(too_long, sizeof(too_long)));
+
+  // The string in the nested text message is too long.
+  const uint8_t nested[] = {0x1A, 0x06, 0x0A, 0x04, 'a', 'b', 'c', 'd'};
+  EXPECT_EQ(::EmbeddedProto::Error::ARRAY_FULL, MsgStr::validate(nested, sizeof(nested)));
+
+  // The string is shorter than its length.
+  const uint8_t truncated[] = {0x0A, 0x03, 'a', 'b'};
+  EXPECT_EQ(::EmbeddedProto::Error::END_OF_BUFFER, MsgStr::validate(truncated, sizeof(truncated)));
+}
+
+TEST(Validate, depth)
+{
+  const uint8_t data[] = {0x02, 0x18, 0x01};
+
+  ::EmbeddedProto::ReadBufferView shallow(data, sizeof(data));
+  EXPECT_EQ(::EmbeddedProto::Error::NO_ERRORS, 
+            MsgA::validate_check_type(shallow, ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED, 
+                                      ::EmbeddedProto::MessageInterface::MAX_VALIDATE_DEPTH - 1));
+
+  ::EmbeddedProto::ReadBufferView deep(data, sizeof(data));
+  EXPECT_EQ(::EmbeddedProto::Error::NESTING_TOO_DEEP, 
+            MsgA::validate_check_type(deep, ::EmbeddedProto::WireFormatter::WireType::LENGTH_DELIMITED, 
+                                      ::EmbeddedProto::MessageInterface::MAX_VALIDATE_DEPTH));
+}
+
+} // End of namespace test_EmbeddedAMS_Validate